@@ -0,0 +1,304 @@
+#include <fstream>
+#include <cstring>
+
+#include "OffsetFinder/OffsetCache.h"
+#include "OffsetFinder/Offsets.h"
+
+#include "Unreal/ObjectArray.h"
+#include "Unreal/NameArray.h"
+#include "Utils.h"
+#include "Menu/Logger.h"
+
+
+std::vector<OffsetCache::CachedValue> OffsetCache::GetCachedValues()
+{
+	auto Value = []<typename T>(T& Var) -> CachedValue
+	{
+		return { &Var, sizeof(T) };
+	};
+
+	/* Changing this list changes the file layout, bump CacheVersion */
+	return {
+		Value(bNamesUseAppendString),
+
+		Value(Settings::Internal::bIsEnumNameOnly),
+		Value(Settings::Internal::bIsSmallEnumValue),
+		Value(Settings::Internal::bIsWeakObjectPtrWithoutTag),
+		Value(Settings::Internal::bUseFProperty),
+		Value(Settings::Internal::bUseNamePool),
+		Value(Settings::Internal::bIsObjectNameBeforeClass),
+		Value(Settings::Internal::bUseCasePreservingName),
+		Value(Settings::Internal::bUseOutlineNumberName),
+		Value(Settings::Internal::bUseMaskForFieldOwner),
+		Value(Settings::Internal::bUseLargeWorldCoordinates),
+
+		Value(Off::InSDK::ProcessEvent::PEIndex),
+		Value(Off::InSDK::ProcessEvent::PEOffset),
+		Value(Off::InSDK::World::GWorld),
+		Value(Off::InSDK::ObjArray::GObjects),
+		Value(Off::InSDK::ObjArray::ChunkSize),
+		Value(Off::InSDK::ObjArray::FUObjectItemSize),
+		Value(Off::InSDK::ObjArray::FUObjectItemInitialOffset),
+		Value(Off::InSDK::Name::bIsUsingAppendStringOverToString),
+		Value(Off::InSDK::Name::AppendNameToString),
+		Value(Off::InSDK::Name::FNameSize),
+		Value(Off::InSDK::NameArray::GNames),
+		Value(Off::InSDK::NameArray::FNamePoolBlockOffsetBits),
+		Value(Off::InSDK::NameArray::FNameEntryStride),
+		Value(Off::InSDK::Properties::PropertySize),
+		Value(Off::InSDK::Text::TextDatOffset),
+		Value(Off::InSDK::Text::InTextDataStringOffset),
+		Value(Off::InSDK::Text::TextSize),
+		Value(Off::InSDK::ULevel::Actors),
+		Value(Off::InSDK::UDataTable::RowMap),
+
+		Value(Off::FUObjectArray::FixedLayout),
+		Value(Off::FUObjectArray::ChunkedFixedLayout),
+		Value(Off::FUObjectArray::bIsChunked),
+
+		Value(Off::NameArray::ChunksStart),
+		Value(Off::NameArray::MaxChunkIndex),
+		Value(Off::NameArray::NumElements),
+		Value(Off::NameArray::ByteCursor),
+
+		Value(Off::FField::Vft),
+		Value(Off::FField::Class),
+		Value(Off::FField::Owner),
+		Value(Off::FField::Next),
+		Value(Off::FField::Name),
+		Value(Off::FField::Flags),
+
+		Value(Off::FFieldClass::Name),
+		Value(Off::FFieldClass::Id),
+		Value(Off::FFieldClass::CastFlags),
+		Value(Off::FFieldClass::ClassFlags),
+		Value(Off::FFieldClass::SuperClass),
+
+		Value(Off::FName::CompIdx),
+		Value(Off::FName::Number),
+
+		Value(Off::FNameEntry::NameArray::StringOffset),
+		Value(Off::FNameEntry::NameArray::IndexOffset),
+		Value(Off::FNameEntry::NamePool::HeaderOffset),
+		Value(Off::FNameEntry::NamePool::StringOffset),
+
+		Value(Off::UObject::Vft),
+		Value(Off::UObject::Flags),
+		Value(Off::UObject::Index),
+		Value(Off::UObject::Class),
+		Value(Off::UObject::Name),
+		Value(Off::UObject::Outer),
+
+		Value(Off::UField::Next),
+		Value(Off::UEnum::Names),
+
+		Value(Off::UStruct::SuperStruct),
+		Value(Off::UStruct::Children),
+		Value(Off::UStruct::ChildProperties),
+		Value(Off::UStruct::Size),
+		Value(Off::UStruct::MinAlignemnt),
+
+		Value(Off::UFunction::FunctionFlags),
+		Value(Off::UFunction::ExecFunction),
+
+		Value(Off::UClass::CastFlags),
+		Value(Off::UClass::ClassDefaultObject),
+		Value(Off::UClass::ImplementedInterfaces),
+
+		Value(Off::Property::ArrayDim),
+		Value(Off::Property::ElementSize),
+		Value(Off::Property::PropertyFlags),
+		Value(Off::Property::Offset_Internal),
+
+		Value(Off::ByteProperty::Enum),
+		Value(Off::BoolProperty::Base),
+		Value(Off::ObjectProperty::PropertyClass),
+		Value(Off::ClassProperty::MetaClass),
+		Value(Off::StructProperty::Struct),
+		Value(Off::ArrayProperty::Inner),
+		Value(Off::DelegateProperty::SignatureFunction),
+		Value(Off::MapProperty::Base),
+		Value(Off::SetProperty::ElementProp),
+		Value(Off::EnumProperty::Base),
+		Value(Off::FieldPathProperty::FieldClass),
+		Value(Off::OptionalProperty::ValueProperty),
+
+		Value(PropertySizes::DelegateProperty),
+		Value(PropertySizes::FieldPathProperty),
+
+		Value(NameArray::FNameBlockOffsetBits),
+		Value(NameArray::NameEntryStride),
+	};
+}
+
+std::vector<uint8> OffsetCache::CaptureValues()
+{
+	std::vector<uint8> Values;
+
+	for (const CachedValue& Cached : GetCachedValues())
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Cached.Address);
+		Values.insert(Values.end(), Bytes, Bytes + Cached.Size);
+	}
+
+	return Values;
+}
+
+void OffsetCache::ApplyValues(const std::vector<uint8>& Values)
+{
+	size_t Offset = 0x0;
+
+	for (const CachedValue& Cached : GetCachedValues())
+	{
+		memcpy(Cached.Address, Values.data() + Offset, Cached.Size);
+		Offset += Cached.Size;
+	}
+}
+
+bool OffsetCache::GetImageKey(CacheHeader& OutHeader)
+{
+	const auto [ImageBase, ImageSize, Header] = GetImageBaseAndSize();
+
+	if (!Header || !GetImageUUID(Header, OutHeader.ImageUUID))
+		return false;
+
+	const std::vector<CachedValue> Values = GetCachedValues();
+
+	OutHeader.ImageSize = ImageSize;
+	OutHeader.NumValues = static_cast<uint32>(Values.size());
+	OutHeader.ValuesSize = 0x0;
+
+	for (const CachedValue& Cached : Values)
+		OutHeader.ValuesSize += Cached.Size;
+
+	return true;
+}
+
+bool OffsetCache::IsRestoredStateValid()
+{
+	if (ObjectArray::Num() < 0x1000)
+		return false;
+
+	/* Every object stores its own index, which checks the GObjects layout and Off::UObject::Index at once */
+	for (const int32 Index : { 0x1, 0x10, 0x100, 0x1000 })
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (!Obj)
+			continue;
+
+		if (IsBadReadPtr(Obj.GetAddress()) || Obj.GetIndex() != Index)
+			return false;
+	}
+
+	/* Checks names and the UObject::Class/Name offsets */
+	UEClass ObjectClass = ObjectArray::FindClassFast("Object");
+
+	return ObjectClass && ObjectClass.GetName() == "Object";
+}
+
+fs::path OffsetCache::GetCachePath()
+{
+	return fs::path(Settings::Generator::SDKGenerationPath) / "Documents" / "Dumper-7-OffsetCache.bin";
+}
+
+bool OffsetCache::TryLoad()
+{
+	CacheHeader ExpectedHeader;
+
+	if (!GetImageKey(ExpectedHeader))
+	{
+		LogInfo("Offset cache: main image has no LC_UUID, not using the cache");
+		return false;
+	}
+
+	std::ifstream CacheFile(GetCachePath(), std::ios::binary);
+
+	if (!CacheFile)
+		return false;
+
+	CacheHeader Header;
+	if (!CacheFile.read(reinterpret_cast<char*>(&Header), sizeof(Header)))
+		return false;
+
+	const bool bIsSameBinary = memcmp(Header.ImageUUID, ExpectedHeader.ImageUUID, sizeof(Header.ImageUUID)) == 0 && Header.ImageSize == ExpectedHeader.ImageSize;
+	const bool bIsSameLayout = Header.Magic == CacheMagic && Header.Version == CacheVersion && Header.NumValues == ExpectedHeader.NumValues && Header.ValuesSize == ExpectedHeader.ValuesSize;
+
+	if (!bIsSameBinary || !bIsSameLayout)
+	{
+		LogInfo("Offset cache: cache is for a different build of the game, doing a full scan");
+		return false;
+	}
+
+	std::vector<uint8> CachedValues(Header.ValuesSize);
+	if (!CacheFile.read(reinterpret_cast<char*>(CachedValues.data()), CachedValues.size()))
+		return false;
+
+	LogInfo("Offset cache: found cache for this build, restoring offsets...");
+
+	const std::vector<uint8> PreviousValues = CaptureValues();
+
+	ApplyValues(CachedValues);
+
+	if (Off::FUObjectArray::bIsChunked)
+	{
+		ObjectArray::Init(Off::InSDK::ObjArray::GObjects, Off::InSDK::ObjArray::ChunkSize, Off::FUObjectArray::ChunkedFixedLayout);
+	}
+	else
+	{
+		ObjectArray::Init(Off::InSDK::ObjArray::GObjects, Off::FUObjectArray::FixedLayout);
+	}
+
+	if (bNamesUseAppendString && Memory::IsLive())
+	{
+		using EOverride = FName::EOffsetOverrideType;
+		FName::Init(Off::InSDK::Name::AppendNameToString, Off::InSDK::Name::bIsUsingAppendStringOverToString ? EOverride::AppendString : EOverride::ToString);
+	}
+	else if (Off::InSDK::NameArray::GNames != 0x0)
+	{
+		FName::Init(Off::InSDK::NameArray::GNames, FName::EOffsetOverrideType::GNames, Settings::Internal::bUseNamePool);
+	}
+
+	/* The manual-override paths above re-derive some of the values, make sure the cached ones are used */
+	ApplyValues(CachedValues);
+
+	if (!IsRestoredStateValid())
+	{
+		LogError("Offset cache: validation failed, doing a full scan");
+
+		ApplyValues(PreviousValues);
+
+		FName::AppendString = nullptr;
+		FName::ToStr = nullptr;
+
+		return false;
+	}
+
+	LogSuccess("Offset cache: engine core restored from '%s'", GetCachePath().string().c_str());
+	return true;
+}
+
+void OffsetCache::Save()
+{
+	CacheHeader Header;
+
+	if (!GetImageKey(Header))
+		return;
+
+	bNamesUseAppendString = FName::AppendString != nullptr;
+
+	const std::vector<uint8> Values = CaptureValues();
+
+	std::ofstream CacheFile(GetCachePath(), std::ios::binary | std::ios::trunc);
+
+	if (!CacheFile)
+	{
+		LogError("Offset cache: could not write '%s'", GetCachePath().string().c_str());
+		return;
+	}
+
+	CacheFile.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+	CacheFile.write(reinterpret_cast<const char*>(Values.data()), Values.size());
+
+	LogInfo("Offset cache: wrote '%s'", GetCachePath().string().c_str());
+}
@@ -139,21 +139,74 @@ void Off::InSDK::World::InitGWorld()
 {
 	UEClass UWorld = ObjectArray::FindClassFast("World");
 
+	/* The persistent world as well as streaming worlds, in GObjects order */
+	std::vector<uintptr_t> Worlds;
+
 	for (UEObject Obj : ObjectArray())
 	{
 		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject) || !Obj.IsA(UWorld))
 			continue;
 
-		/* Try to find a pointer to the word, aka UWorld** GWorld */
-		void* Result = FindAlignedValueInProcess(Obj.GetAddress());
+		Worlds.push_back(reinterpret_cast<uintptr_t>(Obj.GetAddress()));
+	}
 
-		/* Pointer to UWorld* couldn't be found */
-		if (Result)
-		{
-			Off::InSDK::World::GWorld = GetOffset(Result);
-			LogSuccess("GWorld found - Offset: 0x%X", Off::InSDK::World::GWorld);
-			break;
-		}
+	/* Every pointer to any of the worlds, aka UWorld** GWorld candidates, found in one sweep */
+	const std::vector<AlignedPointerHit> Hits = FindAlignedPointersInProcess(Worlds);
+
+	struct GWorldCandidate
+	{
+		uintptr_t Address;
+		int32 WorldOrder;
+		uint32 NumXRefs;
+		uintptr_t DistanceToGObjects;
+	};
+
+	const uintptr_t GObjectsAddress = reinterpret_cast<uintptr_t>(ObjectArray::DEBUGGetGObjects());
+
+	std::vector<GWorldCandidate> Candidates;
+	Candidates.reserve(Hits.size());
+
+	for (const AlignedPointerHit& Hit : Hits)
+	{
+		GWorldCandidate& Candidate = Candidates.emplace_back();
+		Candidate.Address = Hit.Address;
+		Candidate.WorldOrder = static_cast<int32>(std::find(Worlds.begin(), Worlds.end(), Hit.Value) - Worlds.begin());
+		Candidate.NumXRefs = 0x0;
+		Candidate.DistanceToGObjects = Hit.Address > GObjectsAddress ? Hit.Address - GObjectsAddress : GObjectsAddress - Hit.Address;
+
+		/* GWorld is read all over the engine, other copies of a world pointer are barely referenced from code */
+		const auto [FirstXRef, LastXRef] = XRefIndex::GetXRefsTo(Hit.Address);
+
+		if (FirstXRef)
+			Candidate.NumXRefs = static_cast<uint32>(LastXRef - FirstXRef);
+	}
+
+	/* Most code references first, then the first world in GObjects like a serial search would, then globals closest to GObjects */
+	std::sort(Candidates.begin(), Candidates.end(), [](const GWorldCandidate& Left, const GWorldCandidate& Right) -> bool
+	{
+		if (Left.NumXRefs != Right.NumXRefs)
+			return Left.NumXRefs > Right.NumXRefs;
+
+		if (Left.WorldOrder != Right.WorldOrder)
+			return Left.WorldOrder < Right.WorldOrder;
+
+		if (Left.DistanceToGObjects != Right.DistanceToGObjects)
+			return Left.DistanceToGObjects < Right.DistanceToGObjects;
+
+		return Left.Address < Right.Address;
+	});
+
+	LogInfo("GWorld: %zu candidate(s) for %zu UWorld object(s)", Candidates.size(), Worlds.size());
+
+#if DUMPER_MIN_LOG_LEVEL <= 0
+	for (const GWorldCandidate& Candidate : Candidates)
+		LogVerbose("GWorld candidate: 0x%lX (world #%d, %u xrefs, 0x%lX bytes from GObjects)", GetOffset(Candidate.Address), Candidate.WorldOrder, Candidate.NumXRefs, Candidate.DistanceToGObjects);
+#endif
+
+	if (!Candidates.empty())
+	{
+		Off::InSDK::World::GWorld = GetOffset(Candidates.front().Address);
+		LogSuccess("GWorld found - Offset: 0x%X", Off::InSDK::World::GWorld);
 	}
 
 	if (Off::InSDK::World::GWorld == 0x0)
@@ -181,7 +234,7 @@ void Off::InSDK::Text::InitTextOffsets()
 	UEProperty InStringProp = nullptr;
 	UEProperty ReturnProp = nullptr;
 
-	for (UEProperty Prop : Conv_StringToText.GetProperties())
+	for (UEProperty Prop : Conv_StringToText.IterateProperties())
 	{
 		/* Func has 2 params, if the param is the return value assign to ReturnProp, else InStringProp*/
 		(Prop.HasPropertyFlags(EPropertyFlags::ReturnParm) ? ReturnProp : InStringProp) = Prop;
@@ -400,6 +453,124 @@ void Off::Init()
     
     LogSuccess("Offsets initialized successfully.");
 }
+
+/* Set while this thread runs the census, computing alignments can end up in FindOptionalInCensus for property-classes unknown to the dumper */
+static thread_local bool bIsBuildingCensus = false;
+
+void PropertySizes::InitPropertyCensus()
+{
+	std::scoped_lock Lock(CensusLock);
+
+	/* Another thread might have run the census while we were waiting for the lock */
+	if (bIsCensusDone)
+		return;
+
+	bIsBuildingCensus = true;
+
+	for (FPropertyCensusEntry& Entry : Census)
+		Entry = FPropertyCensusEntry{ Entry.PropertyClass };
+
+	OptionalsByValueClass.clear();
+
+	int32 NumObjects = 0x0;
+	int32 NumStructs = 0x0;
+	int32 NumProperties = 0x0;
+	int32 NumClassesFound = 0x0;
+
+	auto RecordProperty = [&](UEProperty Prop) -> void
+	{
+		const EClassCastFlags CastFlags = Prop.GetCastFlags();
+
+		NumProperties++;
+
+		for (FPropertyCensusEntry& Entry : Census)
+		{
+			if (!(CastFlags & Entry.PropertyClass))
+				continue;
+
+			if (Entry.NumOccurrences++ > 0)
+				continue;
+
+			Entry.FirstProperty = Prop.GetAddress();
+			Entry.Size = Prop.GetSize();
+			NumClassesFound++;
+		}
+
+		/* Same filter as the GObjects walk UEProperty::GetAlignment() did for unknown property-classes */
+		if (Settings::Internal::bUseFProperty && (CastFlags & EClassCastFlags::OptionalProperty) && !(CastFlags & EClassCastFlags::ObjectPropertyBase))
+			OptionalsByValueClass.try_emplace(Prop.Cast<UEOptionalProperty>().GetValueProperty().GetClass().second.GetAddress(), Prop.GetAddress());
+	};
+
+	for (UEObject Obj : ObjectArray())
+	{
+		NumObjects++;
+
+		if (!Obj.IsA(EClassCastFlags::Struct))
+			continue;
+
+		NumStructs++;
+
+		for (UEProperty Prop : Obj.Cast<UEStruct>().IterateProperties())
+			RecordProperty(Prop);
+	}
+
+	/* Only once every optional was recorded, the alignment of a TOptional might depend on the one of another property-class */
+	for (FPropertyCensusEntry& Entry : Census)
+	{
+		if (Entry.FirstProperty)
+			Entry.Alignment = UEProperty(Entry.FirstProperty).GetAlignment();
+	}
+
+	bIsBuildingCensus = false;
+	bIsCensusDone = true;
+
+	LogInfo("PropertyCensus: walked %d objects, %d structs, %d properties, found %d of %d tracked property-classes", NumObjects, NumStructs, NumProperties, NumClassesFound, static_cast<int32>(sizeof(Census) / sizeof(*Census)));
+
+#if DUMPER_MIN_LOG_LEVEL <= 0
+	for (const FPropertyCensusEntry& Entry : Census)
+	{
+		if (Entry.FirstProperty)
+			LogVerbose("PropertyCensus: 0x%016llX -> Size 0x%X, Align 0x%X, %d occurrences", static_cast<unsigned long long>(Entry.PropertyClass), Entry.Size, Entry.Alignment, Entry.NumOccurrences);
+	}
+#endif
+}
+
+void PropertySizes::ResetPropertyCensus()
+{
+	std::scoped_lock Lock(CensusLock);
+
+	bIsCensusDone = false;
+
+	for (FPropertyCensusEntry& Entry : Census)
+		Entry = FPropertyCensusEntry{ Entry.PropertyClass };
+
+	OptionalsByValueClass.clear();
+}
+
+const PropertySizes::FPropertyCensusEntry* PropertySizes::FindInCensus(EClassCastFlags PropertyClass)
+{
+	if (!bIsCensusDone && !bIsBuildingCensus)
+		InitPropertyCensus();
+
+	for (const FPropertyCensusEntry& Entry : Census)
+	{
+		if (Entry.PropertyClass == PropertyClass)
+			return Entry.FirstProperty ? &Entry : nullptr;
+	}
+
+	return nullptr;
+}
+
+void* PropertySizes::FindOptionalInCensus(void* ValueClass)
+{
+	if (!bIsCensusDone && !bIsBuildingCensus)
+		InitPropertyCensus();
+
+	auto It = OptionalsByValueClass.find(ValueClass);
+
+	return It != OptionalsByValueClass.end() ? It->second : nullptr;
+}
+
 void PropertySizes::Init()
 {
 	InitTDelegateSize();
@@ -408,23 +579,11 @@ void PropertySizes::Init()
 
 void PropertySizes::InitTDelegateSize()
 {
-	/* If the AudioComponent class or the OnQueueSubtitles member weren't found, fallback to looping GObjects and looking for a Delegate. */
+	/* If the AudioComponent class or the OnQueueSubtitles member weren't found, fallback to the first Delegate the census came across. */
 	auto OnPropertyNotFoudn = [&]() -> void
 	{
-		for (UEObject Obj : ObjectArray())
-		{
-			if (!Obj.IsA(EClassCastFlags::Struct))
-				continue;
-
-			for (UEProperty Prop : Obj.Cast<UEClass>().GetProperties())
-			{
-				if (Prop.IsA(EClassCastFlags::DelegateProperty))
-				{
-					PropertySizes::DelegateProperty = Prop.GetSize();
-					return;
-				}
-			}
-		}
+		if (const FPropertyCensusEntry* Entry = FindInCensus(EClassCastFlags::DelegateProperty))
+			PropertySizes::DelegateProperty = Entry->Size;
 	};
 
 	const UEClass AudioComponentClass = ObjectArray::FindClassFast("AudioComponent");
@@ -445,23 +604,11 @@ void PropertySizes::InitFFieldPathSize()
 	if (!Settings::Internal::bUseFProperty)
 		return;
 
-	/* If the SetFieldPathPropertyByName function or the Value parameter weren't found, fallback to looping GObjects and looking for a Delegate. */
+	/* If the SetFieldPathPropertyByName function or the Value parameter weren't found, fallback to the first FieldPath the census came across. */
 	auto OnPropertyNotFoudn = [&]() -> void
 	{
-		for (UEObject Obj : ObjectArray())
-		{
-			if (!Obj.IsA(EClassCastFlags::Struct))
-				continue;
-
-			for (UEProperty Prop : Obj.Cast<UEClass>().GetProperties())
-			{
-				if (Prop.IsA(EClassCastFlags::FieldPathProperty))
-				{
-					PropertySizes::FieldPathProperty = Prop.GetSize();
-					return;
-				}
-			}
-		}
+		if (const FPropertyCensusEntry* Entry = FindInCensus(EClassCastFlags::FieldPathProperty))
+			PropertySizes::FieldPathProperty = Entry->Size;
 	};
 
 	const UEFunction SetFieldPathPropertyByNameFunc = ObjectArray::FindObjectFast<UEFunction>("SetFieldPathPropertyByName", EClassCastFlags::Function);
@@ -0,0 +1,9 @@
+#include "Unreal/CacheStats.h"
+
+#include "Menu/Logger.h"
+
+
+void LogCacheStats(const char* CacheName, const char* EntryName, const CacheStats& Stats)
+{
+	LogInfo("%s: %llu %s (%llu KiB), %llu lookups, %.2f%% hit rate", CacheName, Stats.NumEntries, EntryName, Stats.ArenaBytes / 1024, Stats.GetNumLookups(), Stats.GetHitRate());
+}
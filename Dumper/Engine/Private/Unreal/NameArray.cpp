@@ -29,7 +29,9 @@ std::string FNameEntry::GetString()
     if (!Address)
         return "";
 
-    return std::string(GetWString().begin(), GetWString().end());
+    const UnrealString WideString = GetWString();
+
+    return std::string(WideString.begin(), WideString.end());
 }
 
 void* FNameEntry::GetAddress()
@@ -482,7 +484,7 @@ bool NameArray::TryFindNameArray()
                 if (AdrpReg == AddBaseReg && AdrpReg == AddDestReg)
                 {
                     uintptr ResolvedAddr = ResolveARM64Adr(CurrentAddr, Inst, NextInst);
-                    LogInfo("[NameArray] Found ADRP+ADD pattern at 0x%p -> 0x%p", (void*)CurrentAddr, (void*)ResolvedAddr);
+                    LogVerbose("[NameArray] Found ADRP+ADD pattern at 0x%p -> 0x%p", (void*)CurrentAddr, (void*)ResolvedAddr);
                     
                     if (!IsBadReadPtr(ResolvedAddr))
                     {
@@ -517,7 +519,7 @@ bool NameArray::TryFindNameArray()
                     uint32 offset = imm12 << 3; // Scale for 64-bit
                     
                     uintptr PtrAddr = BaseAddr + offset;
-                    LogInfo("[NameArray] Found ADRP+LDR pattern at 0x%p -> ptr at 0x%p", (void*)CurrentAddr, (void*)PtrAddr);
+                    LogVerbose("[NameArray] Found ADRP+LDR pattern at 0x%p -> ptr at 0x%p", (void*)CurrentAddr, (void*)PtrAddr);
                     
                     if (!IsBadReadPtr(PtrAddr))
                     {
@@ -0,0 +1,171 @@
+#include <cstring>
+#include <algorithm>
+
+#include "Unreal/NameCache.h"
+#include "Unreal/UnrealTypes.h"
+
+#include "OffsetFinder/Offsets.h"
+#include "Utils/Encoding/UtfN.hpp"
+#include "Menu/Logger.h"
+
+
+std::string_view NameCache::StoreString(std::string_view String)
+{
+	if (String.empty())
+		return std::string_view();
+
+	if (ArenaBlockUsed + String.size() > ArenaBlockSize)
+	{
+		/* Oversized names get a block of their own, which is full right away */
+		ArenaBlocks.emplace_back(new char[std::max(String.size(), ArenaBlockSize)]);
+		ArenaBlockUsed = 0x0;
+	}
+
+	char* Data = ArenaBlocks.back().get() + ArenaBlockUsed;
+	memcpy(Data, String.data(), String.size());
+
+	ArenaBlockUsed += String.size();
+	ArenaBytes += String.size();
+
+	return std::string_view(Data, String.size());
+}
+
+const NameCache::CachedName* NameCache::Find(int32 ComparisonIndex, uint32 Number)
+{
+	if (Number != 0)
+	{
+		std::shared_lock Lock(NumberedNamesLock);
+
+		auto It = NumberedNames.find(GetNumberedKey(ComparisonIndex, Number));
+		return It != NumberedNames.end() ? It->second : nullptr;
+	}
+
+	const Page* FoundPage = Pages[ComparisonIndex / EntriesPerPage].load(std::memory_order_acquire);
+
+	if (!FoundPage)
+		return nullptr;
+
+	return FoundPage->Entries[ComparisonIndex % EntriesPerPage].load(std::memory_order_acquire);
+}
+
+const NameCache::CachedName* NameCache::DecodeAndStore(int32 ComparisonIndex, uint32 Number)
+{
+	/* Large enough for every FName layout, zeroed so padding and the display-index never contain garbage */
+	alignas(0x8) uint8 FakeName[0x20] = { 0x0 };
+
+	memcpy(FakeName + Off::FName::CompIdx, &ComparisonIndex, sizeof(ComparisonIndex));
+
+	if (Number != 0)
+		memcpy(FakeName + Off::FName::Number, &Number, sizeof(Number));
+
+	const UnrealString RawWideName = FName(FakeName).ToRawWString();
+
+	const size_t SlashPos = RawWideName.rfind('/');
+	UnrealString WideName = SlashPos == UnrealString::npos ? RawWideName : RawWideName.substr(SlashPos + 1);
+
+	const std::string RawName = UtfN::WStringToString(RawWideName);
+	const std::string_view RawNameView = StoreString(RawName);
+
+	CachedName& Entry = OwnedNames.emplace_back();
+	Entry.RawName = RawNameView;
+	Entry.Name = SlashPos == UnrealString::npos ? RawNameView : StoreString(UtfN::WStringToString(WideName));
+	Entry.ValidName = StoreString(MakeNameValid(std::move(WideName)));
+
+	if (Number != 0)
+	{
+		std::unique_lock Lock(NumberedNamesLock);
+		NumberedNames.emplace(GetNumberedKey(ComparisonIndex, Number), &Entry);
+
+		return &Entry;
+	}
+
+	const int32 PageIdx = ComparisonIndex / EntriesPerPage;
+	Page* TargetPage = Pages[PageIdx].load(std::memory_order_acquire);
+
+	if (!TargetPage)
+	{
+		TargetPage = OwnedPages.emplace_back(std::make_unique<Page>()).get();
+		Pages[PageIdx].store(TargetPage, std::memory_order_release);
+	}
+
+	/* Release, the strings have to be visible to readers before the pointer is */
+	TargetPage->Entries[ComparisonIndex % EntriesPerPage].store(&Entry, std::memory_order_release);
+
+	return &Entry;
+}
+
+void NameCache::Enable()
+{
+	std::scoped_lock Lock(WriteLock);
+
+	/* Case-preserving names are decoded through their display-index, which isn't part of the cache key */
+	if (Settings::Internal::bUseCasePreservingName)
+	{
+		LogInfo("NameCache: names are case-preserving, not caching decoded names");
+		return;
+	}
+
+	if (!Pages)
+		Pages = std::make_unique<std::atomic<Page*>[]>(NumPages);
+
+	bIsEnabled.store(true, std::memory_order_release);
+}
+
+void NameCache::Reset()
+{
+	std::scoped_lock Lock(WriteLock);
+	std::unique_lock NumberedLock(NumberedNamesLock);
+
+	bIsEnabled.store(false, std::memory_order_release);
+
+	Pages.reset();
+	NumberedNames.clear();
+
+	OwnedPages.clear();
+	OwnedNames.clear();
+	ArenaBlocks.clear();
+	ArenaBlockUsed = ArenaBlockSize;
+	ArenaBytes = 0x0;
+
+	Counters.Reset();
+}
+
+const NameCache::CachedName& NameCache::Get(int32 ComparisonIndex, uint32 Number)
+{
+	if (ComparisonIndex < 0)
+		ComparisonIndex = 0x0;
+
+	if (const CachedName* Found = Find(ComparisonIndex, Number))
+	{
+		Counters.AddHit();
+		return *Found;
+	}
+
+	std::scoped_lock Lock(WriteLock);
+
+	/* Another thread might have decoded this name while we were waiting for the lock */
+	if (const CachedName* Found = Find(ComparisonIndex, Number))
+	{
+		Counters.AddHit();
+		return *Found;
+	}
+
+	Counters.AddMiss();
+
+	return *DecodeAndStore(ComparisonIndex, Number);
+}
+
+NameCache::Stats NameCache::GetStats()
+{
+	std::scoped_lock Lock(WriteLock);
+
+	return Counters.MakeStats(static_cast<uint64>(OwnedNames.size()), static_cast<uint64>(ArenaBytes));
+}
+
+void NameCache::LogStats()
+{
+	if (!IsEnabled())
+		return;
+
+	LogCacheStats("NameCache", "names", GetStats());
+}
@@ -4,10 +4,19 @@
 #include <format>
 #include <filesystem>
 #include <unistd.h>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
 
 #include "Unreal/ObjectArray.h"
+#include "Unreal/ObjectPathCache.h"
+#include "Unreal/StructChildCache.h"
+#include "Unreal/ReflectionSnapshot.h"
 #include "OffsetFinder/Offsets.h"
 #include "Utils.h"
+#include "IO/BufferedFileWriter.h"
 #include "Menu/Logger.h"
 
 
@@ -68,13 +77,10 @@ bool IsAddressValidGObjects(const uintptr Address, const FFixedUObjectArrayLayou
 		uint8 Pad[0x10];
 	};
 
-	void* Objects = *reinterpret_cast<void**>(Address + Layout.ObjectsOffset);
 	const int32 MaxElements = *reinterpret_cast<const int32*>(Address + Layout.MaxObjectsOffset);
 	const int32 NumElements = *reinterpret_cast<const int32*>(Address + Layout.NumObjectsOffset);
 
-
-	FUObjectItem* ObjectsButDecrypted = (FUObjectItem*)ObjectArray::DecryptPtr(Objects);
-
+	/* Integer checks first, they reject almost every address without probing any pointer */
 	if (NumElements > MaxElements)
         return false;
 
@@ -84,6 +90,10 @@ bool IsAddressValidGObjects(const uintptr Address, const FFixedUObjectArrayLayou
 	if (NumElements < 0x1000)
 		return false;
 
+	void* Objects = *reinterpret_cast<void**>(Address + Layout.ObjectsOffset);
+
+	FUObjectItem* ObjectsButDecrypted = (FUObjectItem*)ObjectArray::DecryptPtr(Objects);
+
 	if (IsBadReadPtr(ObjectsButDecrypted))
         return false;
 
@@ -96,20 +106,17 @@ bool IsAddressValidGObjects(const uintptr Address, const FFixedUObjectArrayLayou
 	if (IndexOfFithobject != 0x5)
 		return false;
 
-	LogInfo("FFixedUObjectArray validation successful");
 	return true;
 }
 
 bool IsAddressValidGObjects(const uintptr Address, const FChunkedFixedUObjectArrayLayout& Layout)
 {
-	void* Objects = *reinterpret_cast<void**>(Address + Layout.ObjectsOffset);
 	const int32 MaxElements = *reinterpret_cast<const int32*>(Address + Layout.MaxElementsOffset);
 	const int32 NumElements = *reinterpret_cast<const int32*>(Address + Layout.NumElementsOffset);
 	const int32 MaxChunks   = *reinterpret_cast<const int32*>(Address + Layout.MaxChunksOffset);
 	const int32 NumChunks   = *reinterpret_cast<const int32*>(Address + Layout.NumChunksOffset);
 
-	void** ObjectsPtrButDecrypted = reinterpret_cast<void**>(ObjectArray::DecryptPtr(Objects));
-
+	/* Integer checks first, they reject almost every address without probing any pointer */
 	if (NumChunks > 0x14 || NumChunks < 0x1)
 		return false;
 
@@ -131,6 +138,9 @@ bool IsAddressValidGObjects(const uintptr Address, const FChunkedFixedUObjectArr
 	if (!bMaxChunksFitsMaxElements)
 		return false;
 	
+	void* Objects = *reinterpret_cast<void**>(Address + Layout.ObjectsOffset);
+
+	void** ObjectsPtrButDecrypted = reinterpret_cast<void**>(ObjectArray::DecryptPtr(Objects));
 
 	/* The chunk-pointer must always be valid (especially because it's already decrypted [if it was encrypted at all]) */
 	if (!ObjectsPtrButDecrypted || IsBadReadPtr(ObjectsPtrButDecrypted))
@@ -144,10 +154,102 @@ bool IsAddressValidGObjects(const uintptr Address, const FChunkedFixedUObjectArr
 			return false;
 	}
 	
-	LogInfo("FChunkedFixedUObjectArray validation successful");
 	return true;
 }
 
+struct GObjectsCandidate
+{
+	uintptr Address = 0x0;
+	bool bIsChunked = false;
+	int32 LayoutIndex = -1;
+};
+
+/* Index of the first layout in 'Layouts' that 'Address' is valid for, or -1 */
+template<typename ArrayLayoutType, size_t Size>
+static int32 FindMatchingLayout(const std::array<ArrayLayoutType, Size>& Layouts, uintptr Address)
+{
+	for (size_t i = 0; i < Size; i++)
+	{
+		if (IsAddressValidGObjects(Address, Layouts[i]))
+			return static_cast<int32>(i);
+	}
+
+	return -1;
+}
+
+/*
+* Tests every 4-byte aligned address in [SearchBase, SearchBase + SearchRange) against all known layouts, using all hardware threads.
+*
+* The range is handed out in ascending chunks. Once a match was found no chunk starting above it is scanned anymore, and since every
+* thread walks its chunk in ascending order the result is always the lowest matching address, exactly like a serial scan.
+*/
+static GObjectsCandidate FindLowestGObjectsCandidate(uintptr SearchBase, uintptr SearchRange)
+{
+	constexpr uintptr ChunkSize = 0x100000;
+
+	const uintptr NumChunks = (SearchRange + ChunkSize - 1) / ChunkSize;
+	const uint32 NumThreads = std::max(1u, std::min<uint32>(std::thread::hardware_concurrency(), static_cast<uint32>(NumChunks)));
+
+	std::atomic<uintptr> NextChunk = 0x0;
+	std::atomic<uintptr> LowestMatch = UINTPTR_MAX;
+
+	std::mutex CandidateLock;
+	GObjectsCandidate Lowest;
+
+	auto ScanChunks = [&]() -> void
+	{
+		while (true)
+		{
+			const uintptr ChunkIndex = NextChunk.fetch_add(1);
+
+			if (ChunkIndex >= NumChunks)
+				return;
+
+			const uintptr ChunkStart = SearchBase + (ChunkIndex * ChunkSize);
+			const uintptr ChunkEnd = SearchBase + std::min(SearchRange, (ChunkIndex + 1) * ChunkSize);
+
+			/* Chunks are handed out in ascending order, every following chunk is above the current match as well */
+			if (ChunkStart >= LowestMatch.load(std::memory_order_relaxed))
+				return;
+
+			for (uintptr Address = ChunkStart; Address < ChunkEnd; Address += 0x4)
+			{
+				if (Address >= LowestMatch.load(std::memory_order_relaxed))
+					break;
+
+				GObjectsCandidate Candidate = { Address, false, FindMatchingLayout(FFixedUObjectArrayLayouts, Address) };
+
+				if (Candidate.LayoutIndex == -1)
+					Candidate = { Address, true, FindMatchingLayout(FChunkedFixedUObjectArrayLayouts, Address) };
+
+				if (Candidate.LayoutIndex == -1)
+					continue;
+
+				std::scoped_lock Lock(CandidateLock);
+
+				if (Address < LowestMatch.load(std::memory_order_relaxed))
+				{
+					Lowest = Candidate;
+					LowestMatch.store(Address, std::memory_order_relaxed);
+				}
+
+				break;
+			}
+		}
+	};
+
+	std::vector<std::thread> Workers;
+	Workers.reserve(NumThreads);
+
+	for (uint32 i = 0; i < NumThreads; i++)
+		Workers.emplace_back(ScanChunks);
+
+	for (std::thread& Worker : Workers)
+		Worker.join();
+
+	return Lowest;
+}
+
 void ObjectArray::InitializeFUObjectItem(uint8* FirstItemPtr)
 {
     LogInfo("Initializing FUObjectItem...");
@@ -226,6 +328,15 @@ void ObjectArray::InitializeChunkSize(uint8* ChunksPtr)
 /* We don't speak about this function... */
 void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 {
+    /* Paths, child lists, reflection tables and names indexed for the previous GObjects are keyed by indices that are about to change meaning */
+    ObjectPathCache::Reset();
+    StructChildCache::Reset();
+    ReflectionSnapshot::Reset();
+    PropertySizes::ResetPropertyCensus();
+    Memory::InvalidateRegionCache();
+    ResetNameIndex();
+    InitGeneration++;
+
     if (!bScanAllMemory)
         LogInfo("\nDumper-7 by me, you & him\n\n\n");
 
@@ -256,40 +367,23 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
     if (!bScanAllMemory)
         LogInfo("Searching for GObjects...\n\n");
 
-    auto MatchesAnyLayout = []<typename ArrayLayoutType, size_t Size>(const std::array<ArrayLayoutType, Size>& ObjectArrayLayouts, uintptr Address)
-    {
-        for (const ArrayLayoutType& Layout : ObjectArrayLayouts)
-        {
-            if (!IsAddressValidGObjects(Address, Layout))
-                continue;
-
-            if constexpr (std::is_same_v<ArrayLayoutType, FFixedUObjectArrayLayout>)
-            {
-                Off::FUObjectArray::bIsChunked = false;
-                Off::FUObjectArray::FixedLayout = Layout;
-            }
-            else
-            {
-                Off::FUObjectArray::bIsChunked = true;
-                Off::FUObjectArray::ChunkedFixedLayout = Layout;
-            }
+    const GObjectsCandidate Candidate = FindLowestGObjectsCandidate(SearchBase, SearchRange);
 
-            return true;
-        }
-        
-        return false;
-    };
-
-    for (int i = 0; i < SearchRange; i += 0x4)
+    if (Candidate.LayoutIndex != -1)
     {
-        const uintptr CurrentAddress = SearchBase + i;
+        const uintptr GObjectsAddress = Candidate.Address;
 
-        if (MatchesAnyLayout(FFixedUObjectArrayLayouts, CurrentAddress))
+        if (!Candidate.bIsChunked)
         {
-            GObjects = reinterpret_cast<uint8*>(SearchBase + i);
+            LogInfo("FFixedUObjectArray validation successful");
+
+            Off::FUObjectArray::bIsChunked = false;
+            Off::FUObjectArray::FixedLayout = FFixedUObjectArrayLayouts[Candidate.LayoutIndex];
+
+            GObjects = reinterpret_cast<uint8*>(GObjectsAddress);
             NumElementsPerChunk = -1;
 
-            Off::InSDK::ObjArray::GObjects = (SearchBase + i) - ImageBase;
+            Off::InSDK::ObjArray::GObjects = GObjectsAddress - ImageBase;
 
             LogSuccess("Found FFixedUObjectArray GObjects at offset 0x%X", Off::InSDK::ObjArray::GObjects);
 
@@ -309,14 +403,19 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 
             return;
         }
-        else if (MatchesAnyLayout(FChunkedFixedUObjectArrayLayouts, CurrentAddress))
+        else
         {
-            GObjects = reinterpret_cast<uint8*>(SearchBase + i);
+            LogInfo("FChunkedFixedUObjectArray validation successful");
+
+            Off::FUObjectArray::bIsChunked = true;
+            Off::FUObjectArray::ChunkedFixedLayout = FChunkedFixedUObjectArrayLayouts[Candidate.LayoutIndex];
+
+            GObjects = reinterpret_cast<uint8*>(GObjectsAddress);
             NumElementsPerChunk = 0x10000;
             SizeOfFUObjectItem = 0x18;
             FUObjectItemInitialOffset = 0x0;
 
-            Off::InSDK::ObjArray::GObjects = (SearchBase + i) - ImageBase;
+            Off::InSDK::ObjArray::GObjects = GObjectsAddress - ImageBase;
 
             LogSuccess("Found FChunkedFixedUObjectArray GObjects at offset 0x%X", Off::InSDK::ObjArray::GObjects);
 
@@ -363,6 +462,14 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 
 void ObjectArray::Init(int32 GObjectsOffset, const FFixedUObjectArrayLayout& ObjectArrayLayout, const char* const ModuleName)
 {
+	ObjectPathCache::Reset();
+	StructChildCache::Reset();
+	ReflectionSnapshot::Reset();
+	PropertySizes::ResetPropertyCensus();
+	Memory::InvalidateRegionCache();
+	ResetNameIndex();
+	InitGeneration++;
+
 	LogInfo("Initializing ObjectArray with FFixedUObjectArray at offset 0x%X", GObjectsOffset);
 	
 	GObjects = reinterpret_cast<uint8*>(GetModuleBase(ModuleName) + GObjectsOffset);
@@ -391,6 +498,14 @@ void ObjectArray::Init(int32 GObjectsOffset, const FFixedUObjectArrayLayout& Obj
 
 void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChunkedFixedUObjectArrayLayout& ObjectArrayLayout, const char* const ModuleName)
 {
+	ObjectPathCache::Reset();
+	StructChildCache::Reset();
+	ReflectionSnapshot::Reset();
+	PropertySizes::ResetPropertyCensus();
+	Memory::InvalidateRegionCache();
+	ResetNameIndex();
+	InitGeneration++;
+
 	LogInfo("Initializing ObjectArray with FChunkedFixedUObjectArray at offset 0x%X", GObjectsOffset);
 	GObjects = reinterpret_cast<uint8*>(GetModuleBase(ModuleName) + GObjectsOffset);
 	Off::InSDK::ObjArray::GObjects = GObjectsOffset;
@@ -424,7 +539,7 @@ void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChun
 void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
 {
 	LogInfo("Dumping objects to %s...", (Path / "GObjects-Dump.txt").string().c_str());
-	std::ofstream DumpStream(Path / "GObjects-Dump.txt");
+	BufferedFileWriter DumpStream(Path / "GObjects-Dump.txt", std::ios::out, true /* bBackgroundThread */);
 
 	DumpStream << "Object dump by Dumper-7\n\n";
 	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
@@ -434,11 +549,11 @@ void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
 	{
 		if (!bWithPathname)
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
+			DumpStream.Format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
 		}
 		else
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
+			DumpStream.Format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
 		}
 	}
 
@@ -450,7 +565,7 @@ void ObjectArray::DumpObjectsWithProperties(const fs::path& Path, bool bWithPath
 {
 	LogInfo("Dumping objects with properties to %s...", (Path / "GObjects-Dump-WithProperties.txt").string().c_str());
 	
-	std::ofstream DumpStream(Path / "GObjects-Dump-WithProperties.txt");
+	BufferedFileWriter DumpStream(Path / "GObjects-Dump-WithProperties.txt", std::ios::out, true /* bBackgroundThread */);
 
 	DumpStream << "Object dump by Dumper-7\n\n";
 	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
@@ -460,18 +575,18 @@ void ObjectArray::DumpObjectsWithProperties(const fs::path& Path, bool bWithPath
 	{
 		if (!bWithPathname)
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
+			DumpStream.Format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
 		}
 		else
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
+			DumpStream.Format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
 		}
 
 		if (Object.IsA(EClassCastFlags::Struct))
 		{
-			for (UEProperty Prop : Object.Cast<UEStruct>().GetProperties())
+			for (UEProperty Prop : Object.Cast<UEStruct>().IterateProperties())
 			{
-				DumpStream << std::format("[{:08X}] {{{}}}\t{} {}\n", Prop.GetOffset(), Prop.GetAddress(), Prop.GetPropClassName(), Prop.GetName());
+				DumpStream.Format("[{:08X}] {{{}}}\t{} {}\n", Prop.GetOffset(), Prop.GetAddress(), Prop.GetPropClassName(), Prop.GetName());
 			}
 		}
 	}
@@ -492,50 +607,175 @@ UEType ObjectArray::GetByIndex(int32 Index)
 	return UEType(ByIndex(GObjects + Off::FUObjectArray::GetObjectsOffset(), Index, SizeOfFUObjectItem, FUObjectItemInitialOffset, NumElementsPerChunk));
 }
 
-template<typename UEType>
-UEType ObjectArray::FindObject(const std::string& FullName, EClassCastFlags RequiredType)
+void ObjectArray::BuildNameIndex()
 {
-	for (UEObject Object : ObjectArray())
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	const int32 NumObjects = Num();
+
+	const uint32 NumThreads = std::max(1u, std::min<uint32>(std::thread::hardware_concurrency(), static_cast<uint32>(NumObjects / 0x1000) + 1));
+	const int32 ChunkSize = (NumObjects + NumThreads - 1) / NumThreads;
+
+	auto IndexChunk = [](int32 ChunkStart, int32 ChunkEnd, std::vector<NameIndexEntry>& OutEntries) -> void
 	{
-		if (Object.IsA(RequiredType) && Object.GetFullName() == FullName)
+		OutEntries.reserve(ChunkEnd - ChunkStart);
+
+		for (int32 i = ChunkStart; i < ChunkEnd; i++)
 		{
-			return Object.Cast<UEType>();
+			const UEObject Object = GetByIndex(i);
+
+			if (!Object)
+				continue;
+
+			OutEntries.push_back({ HashName(Object.GetFName().ToStringView()), i });
 		}
+	};
+
+	std::vector<std::vector<NameIndexEntry>> ChunkEntries(NumThreads);
+	std::vector<std::thread> Workers;
+	Workers.reserve(NumThreads);
+
+	for (uint32 i = 0; i < NumThreads; i++)
+	{
+		const int32 ChunkStart = std::min<int32>(i * ChunkSize, NumObjects);
+		const int32 ChunkEnd = std::min<int32>(ChunkStart + ChunkSize, NumObjects);
+
+		Workers.emplace_back(IndexChunk, ChunkStart, ChunkEnd, std::ref(ChunkEntries[i]));
 	}
 
-	return UEType();
+	size_t NumEntries = 0x0;
+	for (uint32 i = 0; i < NumThreads; i++)
+	{
+		Workers[i].join();
+		NumEntries += ChunkEntries[i].size();
+	}
+
+	NameIndex.clear();
+	NameIndex.reserve(NumEntries);
+
+	for (const std::vector<NameIndexEntry>& Entries : ChunkEntries)
+		NameIndex.insert(NameIndex.end(), Entries.begin(), Entries.end());
+
+	/* Chunks are already ordered by index, a stable sort by hash keeps the lowest index first for every name */
+	std::stable_sort(NameIndex.begin(), NameIndex.end(), [](const NameIndexEntry& Left, const NameIndexEntry& Right) { return Left.NameHash < Right.NameHash; });
+
+	NumIndexedObjects = NumObjects;
+	bIsNameIndexBuilt = true;
+
+	const auto EndTime = std::chrono::high_resolution_clock::now();
+	const auto Duration = std::chrono::duration_cast<std::chrono::milliseconds>(EndTime - StartTime);
+
+	LogInfo("Built object name index: %zu objects (%d threads, %lldms)", NameIndex.size(), NumThreads, static_cast<long long>(Duration.count()));
 }
 
-template<typename UEType>
-UEType ObjectArray::FindObjectFast(const std::string& Name, EClassCastFlags RequiredType)
+void ObjectArray::EnableNameIndex()
 {
-	auto ObjArray = ObjectArray();
+	bIsNameIndexEnabled = true;
+}
+
+void ObjectArray::RebuildNameIndex()
+{
+	std::unique_lock Lock(NameIndexLock);
+
+	bIsNameIndexBuilt = false;
+}
 
-	for (UEObject Object : ObjArray)
+void ObjectArray::ResetNameIndex()
+{
+	std::unique_lock Lock(NameIndexLock);
+
+	bIsNameIndexEnabled = false;
+	bIsNameIndexBuilt = false;
+
+	NameIndex.clear();
+	NameIndex.shrink_to_fit();
+	NumIndexedObjects = 0x0;
+}
+
+template<typename PredicateType>
+UEObject ObjectArray::FindByName(std::string_view Name, PredicateType&& Predicate)
+{
+	int32 FirstUnindexedObject = 0x0;
+
+	if (bIsNameIndexEnabled)
 	{
-		if (Object.IsA(RequiredType) && Object.GetName() == Name)
+		if (!bIsNameIndexBuilt)
 		{
-			return Object.Cast<UEType>();
+			std::unique_lock Lock(NameIndexLock);
+
+			/* Another thread might have built the index while we were waiting for the lock */
+			if (!bIsNameIndexBuilt)
+				BuildNameIndex();
 		}
+
+		std::shared_lock Lock(NameIndexLock);
+
+		const uint64 NameHash = HashName(Name);
+
+		auto It = std::lower_bound(NameIndex.begin(), NameIndex.end(), NameHash, [](const NameIndexEntry& Entry, uint64 Hash) { return Entry.NameHash < Hash; });
+
+		for (; It != NameIndex.end() && It->NameHash == NameHash; ++It)
+		{
+			const UEObject Object = GetByIndex(It->ObjectIndex);
+
+			/* Hashes can collide and slots can be reused by a different object after garbage collection */
+			if (Object && Object.GetFName().ToStringView() == Name && Predicate(Object))
+				return Object;
+		}
+
+		FirstUnindexedObject = NumIndexedObjects;
 	}
 
-	return UEType();
+	for (int32 i = FirstUnindexedObject; i < Num(); i++)
+	{
+		const UEObject Object = GetByIndex(i);
+
+		if (Object && Object.GetFName().ToStringView() == Name && Predicate(Object))
+			return Object;
+	}
+
+	return UEObject();
 }
 
 template<typename UEType>
-UEType ObjectArray::FindObjectFastInOuter(const std::string& Name, std::string Outer)
+UEType ObjectArray::FindObject(const std::string& FullName, EClassCastFlags RequiredType)
 {
-	auto ObjArray = ObjectArray();
+	/* "Class Outer.Name", the name itself might contain a '.' so every part following one is a possible name */
+	const size_t ClassNameEnd = FullName.find(' ');
+
+	if (ClassNameEnd == std::string::npos)
+		return UEType();
 
-	for (UEObject Object : ObjArray)
+	auto IsMatchingObject = [&](const UEObject Candidate) -> bool
 	{
-		if (Object.GetName() == Name && Object.GetOuter().GetName() == Outer)
-		{
+		return Candidate.IsA(RequiredType) && Candidate.GetFullName() == FullName;
+	};
+
+	for (size_t NameStart = FullName.rfind('.'); NameStart != std::string::npos && NameStart > ClassNameEnd; NameStart = FullName.rfind('.', NameStart - 1))
+	{
+		if (const UEObject Object = FindByName(std::string_view(FullName).substr(NameStart + 1), IsMatchingObject))
 			return Object.Cast<UEType>();
-		}
 	}
 
-	return UEType();
+	const UEObject Object = FindByName(std::string_view(FullName).substr(ClassNameEnd + 1), IsMatchingObject);
+
+	return Object.Cast<UEType>();
+}
+
+template<typename UEType>
+UEType ObjectArray::FindObjectFast(const std::string& Name, EClassCastFlags RequiredType)
+{
+	const UEObject Object = FindByName(Name, [RequiredType](const UEObject Candidate) -> bool { return Candidate.IsA(RequiredType); });
+
+	return Object.Cast<UEType>();
+}
+
+template<typename UEType>
+UEType ObjectArray::FindObjectFastInOuter(const std::string& Name, std::string Outer)
+{
+	const UEObject Object = FindByName(Name, [&Outer](const UEObject Candidate) -> bool { return Candidate.GetOuter().GetName() == Outer; });
+
+	return Object.Cast<UEType>();
 }
 
 UEStruct ObjectArray::FindStruct(const std::string& Name)
@@ -604,78 +844,33 @@ int32 ObjectArray::ObjectsIterator::GetIndex() const
 }
 
 /*
-* The compiler won't generate functions for a specific template type unless it's used in the .cpp file corresponding to the
-* header it was declatred in.
+* The compiler won't generate functions for a specific template type unless it's instantiated in the .cpp file corresponding to the
+* header it was declatred in. Explicit instantiations are emitted regardless of inlining, merely calling the functions once isn't
+* enough at higher optimization levels.
 *
 * See https://stackoverflow.com/questions/456713/why-do-i-get-unresolved-external-symbol-errors-when-using-templates
 */
-[[maybe_unused]] void TemplateTypeCreationForObjectArray(void)
-{
-	ObjectArray::FindObject<UEObject>("");
-	ObjectArray::FindObject<UEField>("");
-	ObjectArray::FindObject<UEEnum>("");
-	ObjectArray::FindObject<UEStruct>("");
-	ObjectArray::FindObject<UEClass>("");
-	ObjectArray::FindObject<UEFunction>("");
-	ObjectArray::FindObject<UEProperty>("");
-	ObjectArray::FindObject<UEByteProperty>("");
-	ObjectArray::FindObject<UEBoolProperty>("");
-	ObjectArray::FindObject<UEObjectProperty>("");
-	ObjectArray::FindObject<UEClassProperty>("");
-	ObjectArray::FindObject<UEStructProperty>("");
-	ObjectArray::FindObject<UEArrayProperty>("");
-	ObjectArray::FindObject<UEMapProperty>("");
-	ObjectArray::FindObject<UESetProperty>("");
-	ObjectArray::FindObject<UEEnumProperty>("");
-
-	ObjectArray::FindObjectFast<UEObject>("");
-	ObjectArray::FindObjectFast<UEField>("");
-	ObjectArray::FindObjectFast<UEEnum>("");
-	ObjectArray::FindObjectFast<UEStruct>("");
-	ObjectArray::FindObjectFast<UEClass>("");
-	ObjectArray::FindObjectFast<UEFunction>("");
-	ObjectArray::FindObjectFast<UEProperty>("");
-	ObjectArray::FindObjectFast<UEByteProperty>("");
-	ObjectArray::FindObjectFast<UEBoolProperty>("");
-	ObjectArray::FindObjectFast<UEObjectProperty>("");
-	ObjectArray::FindObjectFast<UEClassProperty>("");
-	ObjectArray::FindObjectFast<UEStructProperty>("");
-	ObjectArray::FindObjectFast<UEArrayProperty>("");
-	ObjectArray::FindObjectFast<UEMapProperty>("");
-	ObjectArray::FindObjectFast<UESetProperty>("");
-	ObjectArray::FindObjectFast<UEEnumProperty>("");
-
-	ObjectArray::FindObjectFastInOuter<UEObject>("", "");
-	ObjectArray::FindObjectFastInOuter<UEField>("", "");
-	ObjectArray::FindObjectFastInOuter<UEEnum>("", "");
-	ObjectArray::FindObjectFastInOuter<UEStruct>("", "");
-	ObjectArray::FindObjectFastInOuter<UEClass>("", "");
-	ObjectArray::FindObjectFastInOuter<UEFunction>("", "");
-	ObjectArray::FindObjectFastInOuter<UEProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEByteProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEBoolProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEObjectProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEClassProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEStructProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEArrayProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEMapProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UESetProperty>("", "");
-	ObjectArray::FindObjectFastInOuter<UEEnumProperty>("", "");
-
-	ObjectArray::GetByIndex<UEObject>(-1);
-	ObjectArray::GetByIndex<UEField>(-1);
-	ObjectArray::GetByIndex<UEEnum>(-1);
-	ObjectArray::GetByIndex<UEStruct>(-1);
-	ObjectArray::GetByIndex<UEClass>(-1);
-	ObjectArray::GetByIndex<UEFunction>(-1);
-	ObjectArray::GetByIndex<UEProperty>(-1);
-	ObjectArray::GetByIndex<UEByteProperty>(-1);
-	ObjectArray::GetByIndex<UEBoolProperty>(-1);
-	ObjectArray::GetByIndex<UEObjectProperty>(-1);
-	ObjectArray::GetByIndex<UEClassProperty>(-1);
-	ObjectArray::GetByIndex<UEStructProperty>(-1);
-	ObjectArray::GetByIndex<UEArrayProperty>(-1);
-	ObjectArray::GetByIndex<UEMapProperty>(-1);
-	ObjectArray::GetByIndex<UESetProperty>(-1);
-	ObjectArray::GetByIndex<UEEnumProperty>(-1);
-}
+#define INSTANTIATE_OBJECTARRAY_TEMPLATES(UEType) \
+	template UEType ObjectArray::GetByIndex<UEType>(int32); \
+	template UEType ObjectArray::FindObject<UEType>(const std::string&, EClassCastFlags); \
+	template UEType ObjectArray::FindObjectFast<UEType>(const std::string&, EClassCastFlags); \
+	template UEType ObjectArray::FindObjectFastInOuter<UEType>(const std::string&, std::string);
+
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEObject)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEField)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEEnum)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEStruct)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEClass)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEFunction)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEByteProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEBoolProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEObjectProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEClassProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEStructProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEArrayProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEMapProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UESetProperty)
+INSTANTIATE_OBJECTARRAY_TEMPLATES(UEEnumProperty)
+
+#undef INSTANTIATE_OBJECTARRAY_TEMPLATES
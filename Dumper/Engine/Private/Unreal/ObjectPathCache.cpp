@@ -0,0 +1,177 @@
+#include <cstring>
+#include <algorithm>
+
+#include "Unreal/ObjectPathCache.h"
+#include "Unreal/NameCache.h"
+#include "Unreal/UnrealObjects.h"
+
+#include "Menu/Logger.h"
+
+
+std::string_view ObjectPathCache::StoreString(std::string_view String)
+{
+	if (ArenaBlockUsed + String.size() > ArenaBlockSize)
+	{
+		/* Oversized paths get a block of their own, which is full right away */
+		ArenaBlocks.emplace_back(new char[std::max(String.size(), ArenaBlockSize)]);
+		ArenaBlockUsed = 0x0;
+	}
+
+	char* Data = ArenaBlocks.back().get() + ArenaBlockUsed;
+	memcpy(Data, String.data(), String.size());
+
+	ArenaBlockUsed += String.size();
+	ArenaBytes += String.size();
+
+	return std::string_view(Data, String.size());
+}
+
+std::string_view ObjectPathCache::Find(UEObject Object, EPathKind Kind)
+{
+	const std::vector<CachedPath>& Table = Paths[static_cast<uint8>(Kind)];
+
+	const int32 Index = Object.GetIndex();
+
+	if (Index < 0 || Index >= static_cast<int32>(Table.size()))
+		return std::string_view();
+
+	/* Index slots are reused once an object is garbage collected, the path only belongs to the object it was built for */
+	const CachedPath& Entry = Table[Index];
+
+	return Entry.Object == Object.GetAddress() ? Entry.Path : std::string_view();
+}
+
+void ObjectPathCache::Store(UEObject Object, EPathKind Kind, std::string_view Path)
+{
+	std::vector<CachedPath>& Table = Paths[static_cast<uint8>(Kind)];
+
+	const int32 Index = Object.GetIndex();
+
+	if (Index < 0)
+		return;
+
+	/* Only outers are stored, so the table grows with the highest outer index instead of being sized to all of GObjects up front */
+	if (Index >= static_cast<int32>(Table.size()))
+		Table.resize(Index + 1, CachedPath{ nullptr, std::string_view() });
+
+	CachedPath& Entry = Table[Index];
+
+	/* Another thread might have built this path while we were waiting for the lock */
+	if (Entry.Object == Object.GetAddress() && !Entry.Path.empty())
+		return;
+
+	Entry.Object = Object.GetAddress();
+	Entry.Path = StoreString(Path);
+
+	NumPaths++;
+}
+
+void ObjectPathCache::Enable()
+{
+	std::unique_lock WriteLock(Lock);
+
+	/* Path segments are string_views into the NameCache, without it every decoded name would be a temporary */
+	if (!NameCache::IsEnabled())
+	{
+		LogInfo("ObjectPathCache: NameCache is disabled, not caching outer paths");
+		return;
+	}
+
+	bIsEnabled.store(true, std::memory_order_release);
+}
+
+void ObjectPathCache::Reset()
+{
+	std::unique_lock WriteLock(Lock);
+
+	bIsEnabled.store(false, std::memory_order_release);
+
+	for (std::vector<CachedPath>& Table : Paths)
+	{
+		Table.clear();
+		Table.shrink_to_fit();
+	}
+
+	ArenaBlocks.clear();
+	ArenaBlockUsed = ArenaBlockSize;
+	ArenaBytes = 0x0;
+	NumPaths = 0x0;
+
+	Counters.Reset();
+}
+
+std::string_view ObjectPathCache::GetPath(UEObject Object, EPathKind Kind)
+{
+	if (!Object)
+		return std::string_view();
+
+	/* Object and its outers up to, but excluding, the first one that already has a path, innermost first */
+	std::vector<UEObject> Chain;
+	std::string_view KnownPath;
+
+	{
+		std::shared_lock ReadLock(Lock);
+
+		for (UEObject Current = Object; Current; Current = Current.GetOuter())
+		{
+			KnownPath = Find(Current, Kind);
+
+			if (!KnownPath.empty())
+				break;
+
+			Chain.push_back(Current);
+		}
+	}
+
+	if (Chain.empty())
+	{
+		Counters.AddHit();
+		return KnownPath;
+	}
+
+	Counters.AddMiss();
+
+	/* Builds the path of the whole chain at once, the path of every link is a prefix of it */
+	std::string Path;
+	Path.reserve(KnownPath.size() + Chain.size() * 0x20);
+	Path += KnownPath;
+
+	std::vector<size_t> PathEnds(Chain.size());
+
+	for (int32 i = static_cast<int32>(Chain.size()) - 1; i >= 0; i--)
+	{
+		const FName Name = Chain[i].GetFName();
+
+		if (!Path.empty())
+			Path += '.';
+
+		Path += Kind == EPathKind::NameWithPath ? Name.ToRawStringView() : Name.ToStringView();
+		PathEnds[i] = Path.size();
+	}
+
+	std::unique_lock WriteLock(Lock);
+
+	/* Reset() might have been called in the meantime, views into the arena must not outlive it */
+	if (!IsEnabled())
+		return std::string_view();
+
+	for (int32 i = static_cast<int32>(Chain.size()) - 1; i >= 0; i--)
+		Store(Chain[i], Kind, std::string_view(Path.data(), PathEnds[i]));
+
+	return Find(Object, Kind);
+}
+
+ObjectPathCache::Stats ObjectPathCache::GetStats()
+{
+	std::shared_lock ReadLock(Lock);
+
+	return Counters.MakeStats(NumPaths, static_cast<uint64>(ArenaBytes));
+}
+
+void ObjectPathCache::LogStats()
+{
+	if (!IsEnabled())
+		return;
+
+	LogCacheStats("ObjectPathCache", "paths", GetStats());
+}
@@ -0,0 +1,183 @@
+#include <chrono>
+
+#include "Unreal/ReflectionSnapshot.h"
+#include "Memory/MemoryReader.h"
+#include "Menu/Logger.h"
+
+
+void ReflectionSnapshot::AddStruct(UEStruct Struct, int32 ObjectIndex)
+{
+	const int32 Slot = Structs.Num();
+
+	Objects.StructSlot[ObjectIndex] = Slot;
+
+	const UEStruct Super = Struct.GetSuper();
+
+	Structs.ObjectIndex.push_back(ObjectIndex);
+	/* Indices are clamped like OuterIndex, the tables are indexed with them without further checks */
+	Structs.SuperIndex.push_back(Super ? ToObjectIndex(Super.GetIndex()) : InvalidIndex);
+	Structs.Size.push_back(Struct.GetStructSize());
+	Structs.MinAlignment.push_back(Struct.GetMinAlignment());
+	Structs.FirstProperty.push_back(Properties.Num());
+	Structs.FirstFunction.push_back(Functions.Num());
+
+	for (UEProperty Property : Struct.IterateProperties())
+	{
+		const EClassCastFlags PropertyCastFlags = Property.GetCastFlags();
+
+		int32 TypeIndex = InvalidIndex;
+
+		if (PropertyCastFlags & EClassCastFlags::StructProperty)
+		{
+			if (const UEStruct UnderlayingStruct = Property.Cast<UEStructProperty>().GetUnderlayingStruct())
+				TypeIndex = UnderlayingStruct.GetIndex();
+		}
+		else if (PropertyCastFlags & EClassCastFlags::EnumProperty)
+		{
+			if (const UEEnum Enum = Property.Cast<UEEnumProperty>().GetEnum())
+				TypeIndex = Enum.GetIndex();
+		}
+		else if (PropertyCastFlags & EClassCastFlags::ByteProperty)
+		{
+			if (const UEEnum Enum = Property.Cast<UEByteProperty>().GetEnum())
+				TypeIndex = Enum.GetIndex();
+		}
+		else if (PropertyCastFlags & EClassCastFlags::ObjectPropertyBase)
+		{
+			if (const UEClass PropertyClass = Property.Cast<UEObjectProperty>().GetPropertyClass())
+				TypeIndex = PropertyClass.GetIndex();
+		}
+
+		Properties.Address.push_back(Property.GetAddress());
+		Properties.OwnerSlot.push_back(Slot);
+		Properties.CastFlags.push_back(PropertyCastFlags);
+		Properties.Offset.push_back(Property.GetOffset());
+		Properties.Size.push_back(Property.GetSize());
+		Properties.ArrayDim.push_back(Property.GetArrayDim());
+		Properties.Alignment.push_back(Property.GetAlignment());
+		Properties.TypeIndex.push_back(ToObjectIndex(TypeIndex));
+	}
+
+	if (Struct.IsA(EClassCastFlags::Class))
+	{
+		for (UEFunction Func : Struct.IterateFunctions())
+		{
+			Functions.ObjectIndex.push_back(Func.GetIndex());
+			Functions.OwnerSlot.push_back(Slot);
+			Functions.FunctionFlags.push_back(Func.GetFunctionFlags());
+		}
+	}
+
+	Structs.NumProperties.push_back(Properties.Num() - Structs.FirstProperty.back());
+	Structs.NumFunctions.push_back(Functions.Num() - Structs.FirstFunction.back());
+}
+
+void ReflectionSnapshot::ResolvePackageIndices()
+{
+	const int32 NumObjects = Objects.Num();
+
+	/* Walks up until an object with a known package is found, then assigns that package to the whole chain */
+	for (int32 i = 0; i < NumObjects; i++)
+	{
+		if (!Objects.Address[i] || Objects.PackageIndex[i] != InvalidIndex)
+			continue;
+
+		int32 Current = i;
+
+		for (int32 Depth = 0; Depth < NumObjects; Depth++)
+		{
+			const int32 Outer = Objects.OuterIndex[Current];
+
+			if (Outer == InvalidIndex || Objects.PackageIndex[Current] != InvalidIndex)
+				break;
+
+			Current = Outer;
+		}
+
+		const int32 Package = Objects.PackageIndex[Current] != InvalidIndex ? Objects.PackageIndex[Current] : Current;
+
+		for (int32 Chain = i; Chain != InvalidIndex && Objects.PackageIndex[Chain] == InvalidIndex; Chain = Objects.OuterIndex[Chain])
+			Objects.PackageIndex[Chain] = Package;
+	}
+}
+
+void ReflectionSnapshot::Init()
+{
+	if (bIsInitialized)
+		return;
+
+	/* Memory might have been unmapped since the engine core was initialized, don't trust readability checks from back then */
+	Memory::InvalidateRegionCache();
+
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	const int32 NumObjects = ObjectArray::Num();
+
+	Objects.Address.assign(NumObjects, nullptr);
+	Objects.CastFlags.assign(NumObjects, EClassCastFlags::None);
+	Objects.Flags.assign(NumObjects, EObjectFlags::NoFlags);
+	Objects.OuterIndex.assign(NumObjects, InvalidIndex);
+	Objects.PackageIndex.assign(NumObjects, InvalidIndex);
+	Objects.StructSlot.assign(NumObjects, InvalidIndex);
+
+	for (UEObject Obj : ObjectArray())
+	{
+		const int32 Index = Obj.GetIndex();
+
+		if (Index < 0 || Index >= NumObjects)
+			continue;
+
+		const UEClass Class = Obj.GetClass();
+		const UEObject Outer = Obj.GetOuter();
+
+		const int32 OuterIndex = Outer ? Outer.GetIndex() : InvalidIndex;
+
+		Objects.Address[Index] = Obj.GetAddress();
+		Objects.CastFlags[Index] = Class ? Class.GetCastFlags() : EClassCastFlags::None;
+		Objects.Flags[Index] = Obj.GetFlags();
+		Objects.OuterIndex[Index] = ToObjectIndex(OuterIndex);
+
+		if (Objects.CastFlags[Index] & EClassCastFlags::Struct)
+		{
+			AddStruct(Obj.Cast<UEStruct>(), Index);
+		}
+		else if (Objects.CastFlags[Index] & EClassCastFlags::Enum)
+		{
+			Enums.ObjectIndex.push_back(Index);
+		}
+	}
+
+	ResolvePackageIndices();
+
+	bIsInitialized = true;
+
+	const auto EndTime = std::chrono::high_resolution_clock::now();
+	const auto Duration = std::chrono::duration_cast<std::chrono::milliseconds>(EndTime - StartTime);
+
+	LogInfo("Reflection snapshot: %d structs, %d properties, %d functions, %d enums (%lldms)", Structs.Num(), Properties.Num(), Functions.Num(), Enums.Num(), static_cast<long long>(Duration.count()));
+}
+
+void ReflectionSnapshot::Reset()
+{
+	Objects = ObjectTable();
+	Structs = StructTable();
+	Properties = PropertyTable();
+	Functions = FunctionTable();
+	Enums = EnumTable();
+
+	bIsInitialized = false;
+}
+
+bool ReflectionSnapshot::HasType(int32 StructSlot, int32 TypeObjectIndex)
+{
+	if (TypeObjectIndex == InvalidIndex)
+		return false;
+
+	for (int32 Slot = StructSlot; Slot != InvalidIndex; Slot = GetStructSlot(Structs.SuperIndex[Slot]))
+	{
+		if (Structs.ObjectIndex[Slot] == TypeObjectIndex)
+			return true;
+	}
+
+	return false;
+}
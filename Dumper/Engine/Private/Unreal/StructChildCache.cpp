@@ -0,0 +1,132 @@
+#include <algorithm>
+
+#include "Unreal/StructChildCache.h"
+#include "Unreal/ObjectArray.h"
+
+#include "Menu/Logger.h"
+
+
+template<typename UEType>
+TCachedChildList<UEType> StructChildCache::GetChildren(UEStruct Struct, TChildTable<UEType>& Table, const TStructChildRange<UEType>& Children)
+{
+	const int32 Index = Struct.GetIndex();
+
+	if (!IsEnabled() || Index < 0)
+		return std::vector<UEType>(Children.begin(), Children.end());
+
+	{
+		std::shared_lock ReadLock(Lock);
+
+		/* Index slots are reused once an object is garbage collected, the span only belongs to the struct it was built for */
+		if (Index < static_cast<int32>(Table.Spans.size()) && Table.Spans[Index].Struct == Struct.GetAddress())
+		{
+			Counters.AddHit();
+			return std::span<const UEType>(static_cast<const UEType*>(Table.Spans[Index].Data), Table.Spans[Index].Num);
+		}
+	}
+
+	Counters.AddMiss();
+
+	/* Walk the list once, outside of the lock, the arena copy below can't overrun what was counted */
+	std::vector<UEType> Copied(Children.begin(), Children.end());
+	const size_t NumChildren = Copied.size();
+
+	std::unique_lock WriteLock(Lock);
+
+	/* Reset() might have been called in the meantime, spans into the arena must not outlive it, so hand out the copy instead */
+	if (!IsEnabled())
+		return Copied;
+
+	if (Index >= static_cast<int32>(Table.Spans.size()))
+		Table.Spans.resize(std::max<size_t>(Index + 1, ObjectArray::Num()), CachedSpan{ nullptr, nullptr, 0 });
+
+	CachedSpan& Entry = Table.Spans[Index];
+
+	/* Another thread might have built this span while we were waiting for the lock */
+	if (Entry.Struct == Struct.GetAddress())
+		return std::span<const UEType>(static_cast<const UEType*>(Entry.Data), Entry.Num);
+
+	UEType* Data = nullptr;
+
+	if (NumChildren > 0)
+	{
+		if (Table.ArenaBlocks.empty() || Table.ArenaBlockUsed + NumChildren > ArenaBlockSize)
+		{
+			/* Oversized lists get a block of their own, which is full right away */
+			Table.ArenaBlocks.emplace_back(new UEType[std::max(NumChildren, ArenaBlockSize)]);
+			Table.ArenaBlockUsed = 0x0;
+		}
+
+		Data = Table.ArenaBlocks.back().get() + Table.ArenaBlockUsed;
+		std::move(Copied.begin(), Copied.end(), Data);
+
+		Table.ArenaBlockUsed += NumChildren;
+	}
+
+	ArenaBytes += NumChildren * sizeof(UEType);
+	NumStructs++;
+
+	Entry = CachedSpan{ Struct.GetAddress(), Data, static_cast<int32>(NumChildren) };
+
+	return std::span<const UEType>(Data, NumChildren);
+}
+
+template<typename UEType>
+void StructChildCache::ResetTable(TChildTable<UEType>& Table)
+{
+	Table.Spans.clear();
+	Table.Spans.shrink_to_fit();
+
+	Table.ArenaBlocks.clear();
+	Table.ArenaBlockUsed = 0x0;
+}
+
+void StructChildCache::Enable()
+{
+	std::unique_lock WriteLock(Lock);
+
+	Properties.Spans.assign(ObjectArray::Num(), CachedSpan{ nullptr, nullptr, 0 });
+	Functions.Spans.assign(ObjectArray::Num(), CachedSpan{ nullptr, nullptr, 0 });
+
+	bIsEnabled.store(true, std::memory_order_release);
+}
+
+void StructChildCache::Reset()
+{
+	std::unique_lock WriteLock(Lock);
+
+	bIsEnabled.store(false, std::memory_order_release);
+
+	ResetTable(Properties);
+	ResetTable(Functions);
+
+	NumStructs = 0x0;
+	ArenaBytes = 0x0;
+
+	Counters.Reset();
+}
+
+TCachedChildList<UEProperty> StructChildCache::GetProperties(UEStruct Struct)
+{
+	return GetChildren(Struct, Properties, Struct.IterateProperties());
+}
+
+TCachedChildList<UEFunction> StructChildCache::GetFunctions(UEStruct Struct)
+{
+	return GetChildren(Struct, Functions, Struct.IterateFunctions());
+}
+
+StructChildCache::Stats StructChildCache::GetStats()
+{
+	std::shared_lock ReadLock(Lock);
+
+	return Counters.MakeStats(NumStructs, ArenaBytes);
+}
+
+void StructChildCache::LogStats()
+{
+	if (!IsEnabled())
+		return;
+
+	LogCacheStats("StructChildCache", "child lists", GetStats());
+}
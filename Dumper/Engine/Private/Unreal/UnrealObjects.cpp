@@ -1,8 +1,11 @@
 
 #include <format>
+#include <mutex>
 
 #include "Unreal/UnrealObjects.h"
 #include "Unreal/ObjectArray.h"
+#include "Unreal/ObjectPathCache.h"
+#include "Unreal/StructChildCache.h"
 #include "OffsetFinder/Offsets.h"
 
 
@@ -153,18 +156,18 @@ std::string UEFField::GetValidName() const
 
 std::string UEFField::GetCppName() const
 {
-	static UEClass ActorClass = ObjectArray::FindClassFast("Actor");
-	static UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+	static CachedClassLookup ActorClass("Actor");
+	static CachedClassLookup InterfaceClass("Interface");
 
 	std::string Temp = GetValidName();
 
 	if (IsA(EClassCastFlags::Class))
 	{
-		if (Cast<UEClass>().HasType(ActorClass))
+		if (Cast<UEClass>().HasType(ActorClass.Get()))
 		{
 			return 'A' + Temp;
 		}
-		else if (Cast<UEClass>().HasType(InterfaceClass))
+		else if (Cast<UEClass>().HasType(InterfaceClass.Get()))
 		{
 			return 'I' + Temp;
 		}
@@ -290,24 +293,18 @@ std::string UEObject::GetValidName() const
 
 std::string UEObject::GetCppName() const
 {
-	static UEClass ActorClass = nullptr;
-	static UEClass InterfaceClass = nullptr;
-
-	if (ActorClass == nullptr)
-		ActorClass = ObjectArray::FindClassFast("Actor");
-
-	if (InterfaceClass == nullptr)
-		InterfaceClass = ObjectArray::FindClassFast("Interface");
+	static CachedClassLookup ActorClass("Actor");
+	static CachedClassLookup InterfaceClass("Interface");
 
 	std::string Temp = GetValidName();
 
 	if (IsA(EClassCastFlags::Class))
 	{
-		if (Cast<UEClass>().HasType(ActorClass))
+		if (Cast<UEClass>().HasType(ActorClass.Get()))
 		{
 			return 'A' + Temp;
 		}
-		else if (Cast<UEClass>().HasType(InterfaceClass))
+		else if (Cast<UEClass>().HasType(InterfaceClass.Get()))
 		{
 			return 'I' + Temp;
 		}
@@ -318,10 +315,54 @@ std::string UEObject::GetCppName() const
 	return 'F' + Temp;
 }
 
+/* "Class Outermost.Outer.Name", assembled in one allocation around the cached path of the outer. Empty if the path isn't cached. */
+static std::string MakeCachedFullName(const UEObject& Obj, ObjectPathCache::EPathKind Kind, int32* OutNameLength = nullptr)
+{
+	const bool bWithPath = Kind == ObjectPathCache::EPathKind::NameWithPath;
+
+	const UEObject Outer = Obj.GetOuter();
+	const std::string_view OuterPath = Outer ? ObjectPathCache::GetPath(Outer, Kind) : std::string_view();
+
+	if (Outer && OuterPath.empty())
+		return std::string();
+
+	const UEClass Class = Obj.GetClass();
+
+	/* Without the NameCache every view returned by ToStringView() aliases the same thread_local buffer, so ClassName is copied before Name is decoded */
+	const std::string_view ClassName = !Class ? "None" : bWithPath ? Class.GetFName().ToRawStringView() : Class.GetFName().ToStringView();
+
+	std::string FullName;
+	FullName.reserve(ClassName.size() + 1 + OuterPath.size() + 1 + 0x40);
+
+	FullName += ClassName;
+	FullName += ' ';
+
+	if (!OuterPath.empty())
+	{
+		FullName += OuterPath;
+		FullName += '.';
+	}
+
+	const std::string_view Name = bWithPath ? Obj.GetFName().ToRawStringView() : Obj.GetFName().ToStringView();
+
+	if (OutNameLength)
+		*OutNameLength = Name.size() + 1;
+
+	FullName += Name;
+
+	return FullName;
+}
+
 std::string UEObject::GetFullName(int32& OutNameLength) const
 {
 	if (*this)
 	{
+		if (ObjectPathCache::IsEnabled())
+		{
+			if (std::string CachedName = MakeCachedFullName(*this, ObjectPathCache::EPathKind::Name, &OutNameLength); !CachedName.empty())
+				return CachedName;
+		}
+
 		std::string Temp;
 
 		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
@@ -344,6 +385,12 @@ std::string UEObject::GetFullName() const
 {
 	if (*this)
 	{
+		if (ObjectPathCache::IsEnabled())
+		{
+			if (std::string CachedName = MakeCachedFullName(*this, ObjectPathCache::EPathKind::Name); !CachedName.empty())
+				return CachedName;
+		}
+
 		std::string Temp;
 
 		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
@@ -366,6 +413,12 @@ std::string UEObject::GetPathName() const
 {
 	if (*this)
 	{
+		if (ObjectPathCache::IsEnabled())
+		{
+			if (std::string CachedName = MakeCachedFullName(*this, ObjectPathCache::EPathKind::NameWithPath); !CachedName.empty())
+				return CachedName;
+		}
+
 		std::string Temp;
 
 		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
@@ -425,6 +478,19 @@ bool UEField::IsNextValid() const
 	return (bool)GetNext();
 }
 
+void StructChildCursor::Advance()
+{
+	Current = bIsFField ? UEFField(Current).GetNext().GetAddress() : UEField(Current).GetNext().GetAddress();
+
+	SkipNonMatching();
+}
+
+void StructChildCursor::SkipNonMatching()
+{
+	while (Current && !(bIsFField ? UEFField(Current).IsA(TypeFlags) : UEField(Current).IsA(TypeFlags)))
+		Current = bIsFField ? UEFField(Current).GetNext().GetAddress() : UEField(Current).GetNext().GetAddress();
+}
+
 std::vector<std::pair<FName, int64>> UEEnum::GetNameValuePairs() const
 {
 	struct alignas(0x4) Name08Byte { uint8 Pad[0x08]; };
@@ -557,39 +623,39 @@ bool UEStruct::HasType(UEStruct Type) const
 
 std::vector<UEProperty> UEStruct::GetProperties() const
 {
-	std::vector<UEProperty> Properties;
+	const TStructChildRange<UEProperty> Properties = IterateProperties();
 
-	if (Settings::Internal::bUseFProperty)
-	{
-		for (UEFField Field = GetChildProperties(); Field; Field = Field.GetNext())
-		{
-			if (Field.IsA(EClassCastFlags::Property))
-				Properties.push_back(Field.Cast<UEProperty>());
-		}
+	return std::vector<UEProperty>(Properties.begin(), Properties.end());
+}
 
-		return Properties;
-	}
+std::vector<UEFunction> UEStruct::GetFunctions() const
+{
+	const TStructChildRange<UEFunction> Functions = IterateFunctions();
 
-	for (UEField Field = GetChild(); Field; Field = Field.GetNext())
-	{
-		if (Field.IsA(EClassCastFlags::Property))
-			Properties.push_back(Field.Cast<UEProperty>());
-	}
+	return std::vector<UEFunction>(Functions.begin(), Functions.end());
+}
 
-	return Properties;
+TStructChildRange<UEProperty> UEStruct::IterateProperties() const
+{
+	if (Settings::Internal::bUseFProperty)
+		return TStructChildRange<UEProperty>(GetChildProperties().GetAddress(), EClassCastFlags::Property, true);
+
+	return TStructChildRange<UEProperty>(GetChild().GetAddress(), EClassCastFlags::Property, false);
 }
 
-std::vector<UEFunction> UEStruct::GetFunctions() const
+TStructChildRange<UEFunction> UEStruct::IterateFunctions() const
 {
-	std::vector<UEFunction> Functions;
+	return TStructChildRange<UEFunction>(GetChild().GetAddress(), EClassCastFlags::Function, false);
+}
 
-	for (UEField Field = GetChild(); Field; Field = Field.GetNext())
-	{
-		if (Field.IsA(EClassCastFlags::Function))
-			Functions.push_back(Field.Cast<UEFunction>());
-	}
+TCachedChildList<UEProperty> UEStruct::GetCachedProperties() const
+{
+	return StructChildCache::GetProperties(*this);
+}
 
-	return Functions;
+TCachedChildList<UEFunction> UEStruct::GetCachedFunctions() const
+{
+	return StructChildCache::GetFunctions(*this);
 }
 
 UEProperty UEStruct::FindMember(const std::string& MemberName, EClassCastFlags TypeFlags) const
@@ -597,23 +663,20 @@ UEProperty UEStruct::FindMember(const std::string& MemberName, EClassCastFlags T
 	if (!Object)
 		return nullptr;
 
+	/* The cheap cast-flag check runs first, names are only compared as views */
 	if (Settings::Internal::bUseFProperty)
 	{
-		for (UEFField Field = GetChildProperties(); Field; Field = Field.GetNext())
+		for (UEFField Field : TStructChildRange<UEFField>(GetChildProperties().GetAddress(), TypeFlags, true))
 		{
-			if (Field.IsA(TypeFlags) && Field.GetName() == MemberName)
-			{
+			if (Field.GetFName().ToStringView() == MemberName)
 				return Field.Cast<UEProperty>();
-			}
 		}
 	}
 
-	for (UEField Field = GetChild(); Field; Field = Field.GetNext())
+	for (UEField Field : TStructChildRange<UEField>(GetChild().GetAddress(), TypeFlags, false))
 	{
-		if (Field.IsA(TypeFlags) && Field.GetName() == MemberName)
-		{
+		if (Field.GetFName().ToStringView() == MemberName)
 			return Field.Cast<UEProperty>();
-		}
 	}
 
 	return nullptr;
@@ -624,24 +687,7 @@ bool UEStruct::HasMembers() const
 	if (!Object)
 		return false;
 
-	if (Settings::Internal::bUseFProperty)
-	{
-		for (UEFField Field = GetChildProperties(); Field; Field = Field.GetNext())
-		{
-			if (Field.IsA(EClassCastFlags::Property))
-				return true;
-		}
-	}
-	else
-	{
-		for (UEField F = GetChild(); F; F = F.GetNext())
-		{
-			if (F.IsA(EClassCastFlags::Property))
-				return true;
-		}
-	}
-
-	return false;
+	return !IterateProperties().IsEmpty();
 }
 
 EClassCastFlags UEClass::GetCastFlags() const
@@ -706,7 +752,7 @@ void* UEFunction::GetExecFunction() const
 
 UEProperty UEFunction::GetReturnProperty() const
 {
-	for (auto Prop : GetProperties())
+	for (UEProperty Prop : IterateProperties())
 	{
 		if (Prop.HasPropertyFlags(EPropertyFlags::ReturnParm))
 			return Prop;
@@ -951,39 +997,27 @@ int32 UEProperty::GetAlignment() const
 
 	if (Settings::Internal::bUseFProperty)
 	{
+		static std::mutex UnknownPropertiesLock;
 		static std::unordered_map<void*, int32> UnknownProperties;
 
-		static auto TryFindPropertyRefInOptionalToGetAlignment = [](std::unordered_map<void*, int32>& OutProperties, void* PropertyClass) -> int32
-		{
-			/* Search for a TOptionalProperty that contains an instance of this property */
-			for (UEObject Obj : ObjectArray())
-			{
-				if (!Obj.IsA(EClassCastFlags::Struct))
-					continue;
-
-				for (UEProperty Prop : Obj.Cast<UEStruct>().GetProperties())
-				{
-					if (!Prop.IsA(EClassCastFlags::OptionalProperty) || Prop.IsA(EClassCastFlags::ObjectPropertyBase))
-						continue;
+		/* Safe to use first member, as we're guaranteed to use FProperty */
+		void* PropertyClass = GetClass().second.GetAddress();
 
-					UEOptionalProperty Optional = Prop.Cast<UEOptionalProperty>();
+		{
+			std::scoped_lock Lock(UnknownPropertiesLock);
 
-					/* Safe to use first member, as we're guaranteed to use FProperty */
-					if (Optional.GetValueProperty().GetClass().second.GetAddress() == PropertyClass)
-						return OutProperties.insert({ PropertyClass, Optional.GetAlignment() }).first->second;
-				}
-			}
+			if (auto It = UnknownProperties.find(PropertyClass); It != UnknownProperties.end())
+				return It->second;
+		}
 
-			return OutProperties.insert({ PropertyClass, 0x1 }).first->second;
-		};
+		/* Use a TOptionalProperty that contains an instance of this property, the census recorded the first one of every value-class. Not locked, the census might compute alignments itself. */
+		void* OptionalProperty = PropertySizes::FindOptionalInCensus(PropertyClass);
 
-		auto It = UnknownProperties.find(GetClass().second.GetAddress());
+		const int32 Alignment = OptionalProperty ? UEProperty(OptionalProperty).Cast<UEOptionalProperty>().GetAlignment() : 0x1;
 
-		/* Safe to use first member, as we're guaranteed to use FProperty */
-		if (It == UnknownProperties.end())
-			return TryFindPropertyRefInOptionalToGetAlignment(UnknownProperties, GetClass().second.GetAddress());
+		std::scoped_lock Lock(UnknownPropertiesLock);
 
-		return It->second;
+		return UnknownProperties.insert({ PropertyClass, Alignment }).first->second;
 	}
 
 	return 0x1;
@@ -3,6 +3,9 @@
 
 #include "Unreal/UnrealTypes.h"
 #include "Unreal/NameArray.h"
+#include "Unreal/NameCache.h"
+#include "Unreal/ObjectPathCache.h"
+#include "Unreal/ObjectArray.h"
 
 #include "Utils/Encoding/UnicodeNames.h"
 #include "Utils/Encoding/UtfN.hpp"
@@ -76,6 +79,15 @@ FName::FName(const void* Ptr)
 
 void FName::Init(bool bForceGNames)
 {
+	/* AppendString is game code and can only be called in the live process */
+	if (!Memory::IsLive())
+		bForceGNames = true;
+
+	/* Names decoded through a previous FName setup would be stale */
+	NameCache::Reset();
+	ObjectPathCache::Reset();
+	ObjectArray::ResetNameIndex();
+
 	LogInfo("Initializing FName system%s...", bForceGNames ? " (Forcing GNames)" : "");
 	
 	// ARM64-specific patterns for AppendString function
@@ -124,11 +136,13 @@ void FName::Init(bool bForceGNames)
 	if (StringRef)
 	{
 		LogInfo("Searching for AppendString function using ARM64 patterns...");
+		std::vector<MemAddress> PatternResults = StringRef.RelativePatterns(PossibleSigs, 0x80, -1 /* auto */);
+
 		int i = 0;
 		while (!AppendString && i < PossibleSigs.size())
 		{
-			LogInfo("Trying ARM64 pattern %d: %s", i, PossibleSigs[i]);
-			AppendString = static_cast<void(*)(const void*, FString&)>(StringRef.RelativePattern(PossibleSigs[i], 0x80, -1 /* auto */));
+			LogVerbose("Trying ARM64 pattern %d: %s", i, PossibleSigs[i]);
+			AppendString = static_cast<void(*)(const void*, FString&)>(PatternResults[i]);
 			if (AppendString)
 			{
 				LogSuccess("Found AppendString with ARM64 pattern %d at 0x%p", i, (void*)AppendString);
@@ -199,6 +213,10 @@ void FName::Init(bool bForceGNames)
 
 void FName::Init(int32 OverrideOffset, EOffsetOverrideType OverrideType, bool bIsNamePool, const char* const ModuleName)
 {
+	NameCache::Reset();
+	ObjectPathCache::Reset();
+	ObjectArray::ResetNameIndex();
+
 	if (OverrideType == EOffsetOverrideType::GNames)
 	{
 		const bool bInitializedSuccessfully = NameArray::TryInit(OverrideOffset, bIsNamePool, ModuleName);
@@ -272,11 +290,13 @@ void FName::InitFallback()
 
 	LogInfo("Trying to find ToString via fallback method (Conv_NameToString at 0x%p)", (void*)Conv_NameToStringAddress);
 	
+	std::vector<MemAddress> PatternResults = Conv_NameToStringAddress.RelativePatterns(PossibleSigs, 0x90, -1 /* auto */);
+
 	int i = 0;
 	while (!AppendString && i < PossibleSigs.size())
 	{
-		LogInfo("Trying ToString fallback pattern %d: %s", i, PossibleSigs[i]);
-		AppendString = static_cast<void(*)(const void*, FString&)>(Conv_NameToStringAddress.RelativePattern(PossibleSigs[i], 0x90, -1 /* auto */));
+		LogVerbose("Trying ToString fallback pattern %d: %s", i, PossibleSigs[i]);
+		AppendString = static_cast<void(*)(const void*, FString&)>(PatternResults[i]);
 		
 		if (AppendString)
 		{
@@ -324,6 +344,9 @@ std::string FName::ToRawString() const
 	if (!Address)
 		return "None";
 
+	if (NameCache::IsEnabled())
+		return std::string(ToRawStringView());
+
 	return UtfN::WStringToString(ToRawWString());
 }
 
@@ -332,14 +355,62 @@ std::string FName::ToString() const
 	if (!Address)
 		return "None";
 
+	if (NameCache::IsEnabled())
+		return std::string(ToStringView());
+
 	return UtfN::WStringToString(ToWString());
 }
 
 std::string FName::ToValidString() const
 {
+	if (Address && NameCache::IsEnabled())
+		return std::string(ToValidStringView());
+
 	return MakeNameValid(ToWString());
 }
 
+std::string_view FName::ToStringView() const
+{
+	if (!Address)
+		return "None";
+
+	if (!NameCache::IsEnabled())
+	{
+		thread_local std::string Decoded;
+		return Decoded = ToString();
+	}
+
+	return NameCache::Get(GetCompIdx(), GetNumber()).Name;
+}
+
+std::string_view FName::ToRawStringView() const
+{
+	if (!Address)
+		return "None";
+
+	if (!NameCache::IsEnabled())
+	{
+		thread_local std::string Decoded;
+		return Decoded = ToRawString();
+	}
+
+	return NameCache::Get(GetCompIdx(), GetNumber()).RawName;
+}
+
+std::string_view FName::ToValidStringView() const
+{
+	if (!Address)
+		return "None";
+
+	if (!NameCache::IsEnabled())
+	{
+		thread_local std::string Decoded;
+		return Decoded = ToValidString();
+	}
+
+	return NameCache::Get(GetCompIdx(), GetNumber()).ValidName;
+}
+
 int32 FName::GetCompIdx() const 
 {
 	return *reinterpret_cast<const int32*>(Address + Off::FName::CompIdx);
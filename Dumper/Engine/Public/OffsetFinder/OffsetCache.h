@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <filesystem>
+
+#include "Unreal/Enums.h"
+
+namespace fs = std::filesystem;
+
+/*
+* Persists everything the engine core resolved (Off::, PropertySizes::, Settings::Internal, ObjectArray/NameArray layout) for one build
+* of the game, so the next run on the same binary can skip the scans in Generator::InitEngineCore().
+*
+* The cache is keyed by the LC_UUID and size of the main image. After restoring, a few objects are probed before the cache is trusted.
+*/
+class OffsetCache
+{
+private:
+	static constexpr uint64 CacheMagic = 0x4548434143374431; // "1D7CACHE"
+	static constexpr uint32 CacheVersion = 1;
+
+	struct CacheHeader
+	{
+		uint64 Magic = CacheMagic;
+		uint32 Version = CacheVersion;
+		uint32 NumValues = 0x0;
+		uint8 ImageUUID[0x10] = { 0x0 };
+		uint64 ImageSize = 0x0;
+		uint64 ValuesSize = 0x0;
+	};
+
+	struct CachedValue
+	{
+		void* Address;
+		size_t Size;
+	};
+
+private:
+	/* Whether FName used AppendString/ToString, rather than GNames, when the cache was written */
+	static inline bool bNamesUseAppendString = false;
+
+private:
+	static std::vector<CachedValue> GetCachedValues();
+
+	static std::vector<uint8> CaptureValues();
+	static void ApplyValues(const std::vector<uint8>& Values);
+
+	static bool GetImageKey(CacheHeader& OutHeader);
+
+	static bool IsRestoredStateValid();
+
+public:
+	static fs::path GetCachePath();
+
+	/* Restores the engine core from the cache. Returns false, and leaves all offsets untouched, on a cache-miss or failed validation. */
+	static bool TryLoad();
+
+	/* Writes the current engine core state to the cache, call once InitEngineCore() resolved everything. */
+	static void Save();
+};
@@ -1,4 +1,9 @@
 #pragma once
+
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+
 #include "Unreal/Enums.h"
 #include "Settings.h"
 
@@ -299,6 +304,50 @@ namespace Off
 
 namespace PropertySizes
 {
+	/* First property of a certain property-class found while walking the property chains of all structs */
+	struct FPropertyCensusEntry
+	{
+		EClassCastFlags PropertyClass;
+
+		void* FirstProperty = nullptr;
+		int32 Size = -1;
+		int32 Alignment = -1;
+		int32 NumOccurrences = 0;
+	};
+
+	/* Property-classes recorded by the census, matched like UEProperty::IsA, so MulticastDelegateProperty also counts its inline/sparse subclasses */
+	inline FPropertyCensusEntry Census[] = {
+		{ EClassCastFlags::DelegateProperty },
+		{ EClassCastFlags::MulticastDelegateProperty },
+		{ EClassCastFlags::MulticastInlineDelegateProperty },
+		{ EClassCastFlags::MulticastSparseDelegateProperty },
+		{ EClassCastFlags::FieldPathProperty },
+		{ EClassCastFlags::OptionalProperty },
+		{ EClassCastFlags::TextProperty },
+		{ EClassCastFlags::InterfaceProperty },
+		{ EClassCastFlags::WeakObjectProperty },
+		{ EClassCastFlags::LazyObjectProperty },
+		{ EClassCastFlags::SoftObjectProperty },
+	};
+
+	/* First TOptional property around a value-property of a certain FFieldClass, keyed by the FFieldClass. FProperty only. */
+	inline std::unordered_map<void*, void*> OptionalsByValueClass;
+
+	inline std::mutex CensusLock;
+	inline std::atomic<bool> bIsCensusDone = false;
+
+	/* Walks every structs property chain once, without allocating per struct, and fills 'Census'. Runs on the first Find* call. */
+	void InitPropertyCensus();
+
+	/* Called whenever GObjects is (re-)initialized, the next Find* call walks the new objects */
+	void ResetPropertyCensus();
+
+	/* Returns nullptr if 'PropertyClass' isn't tracked, or no property of that class exists */
+	const FPropertyCensusEntry* FindInCensus(EClassCastFlags PropertyClass);
+
+	/* Returns the first TOptional property whose value-property is of class 'ValueClass', or nullptr */
+	void* FindOptionalInCensus(void* ValueClass);
+
 	void Init();
 
 	/* These are properties for which their size might change depending on the UE version or compilerflags. */
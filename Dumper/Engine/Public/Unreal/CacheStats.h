@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+
+#include "Unreal/Enums.h"
+
+/* Counters of NameCache, ObjectPathCache and StructChildCache at the time GetStats() was called */
+struct CacheStats
+{
+	uint64 Hits;
+	uint64 Misses;
+
+	/* Names, paths or child lists stored in the cache */
+	uint64 NumEntries;
+	uint64 ArenaBytes;
+
+	inline uint64 GetNumLookups() const { return Hits + Misses; }
+	inline double GetHitRate() const { return GetNumLookups() > 0 ? (static_cast<double>(Hits) / GetNumLookups()) * 100.0 : 0.0; }
+};
+
+/* Hit/miss counters of a cache, safe to bump from any thread */
+class CacheCounters
+{
+private:
+	std::atomic<uint64> Hits = 0x0;
+	std::atomic<uint64> Misses = 0x0;
+
+public:
+	inline void AddHit() { Hits.fetch_add(1, std::memory_order_relaxed); }
+	inline void AddMiss() { Misses.fetch_add(1, std::memory_order_relaxed); }
+
+	inline void Reset()
+	{
+		Hits = 0x0;
+		Misses = 0x0;
+	}
+
+	inline CacheStats MakeStats(uint64 NumEntries, uint64 ArenaBytes) const
+	{
+		return { Hits.load(), Misses.load(), NumEntries, ArenaBytes };
+	}
+};
+
+/* Logs "<CacheName>: <NumEntries> <EntryName> (<KiB> KiB), <lookups> lookups, <rate>% hit rate" */
+void LogCacheStats(const char* CacheName, const char* EntryName, const CacheStats& Stats);
@@ -35,6 +35,9 @@ private:
 
 class NameArray
 {
+private:
+	friend class OffsetCache;
+
 private:
 	static inline uint32 FNameBlockOffsetBits = 0x10;
 private:
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <string_view>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "Unreal/Enums.h"
+#include "Unreal/CacheStats.h"
+
+/*
+* Every FName string decoded once, stored as UTF-8 in an append-only arena.
+*
+* Lookups of names that were already decoded are lock-free. Decoding and inserting a new name takes a lock, string_views handed out
+* stay valid until NameCache::Reset() is called. Only enabled once the engine core is initialized, before that FName offsets and
+* settings may still change.
+*/
+class NameCache
+{
+public:
+	struct CachedName
+	{
+		/* Full name, including the path of the outer for names like "/Script/CoreUObject" */
+		std::string_view RawName;
+
+		/* Part after the last '/', what FName::ToString() returns */
+		std::string_view Name;
+
+		/* Name passed through MakeNameValid() */
+		std::string_view ValidName;
+	};
+
+	using Stats = CacheStats;
+
+private:
+	static constexpr int32 EntriesPerPage = 0x10000;
+	static constexpr int32 NumPages = (INT32_MAX / EntriesPerPage) + 1;
+
+	static constexpr size_t ArenaBlockSize = 0x40000;
+
+	struct Page
+	{
+		std::atomic<const CachedName*> Entries[EntriesPerPage];
+	};
+
+private:
+	static inline std::atomic<bool> bIsEnabled = false;
+
+	static inline std::mutex WriteLock;
+
+	/* Names with FName::Number == 0, indexed by comparison index */
+	static inline std::unique_ptr<std::atomic<Page*>[]> Pages;
+
+	/* Names with FName::Number != 0, keyed by (ComparisonIndex << 32) | Number */
+	static inline std::shared_mutex NumberedNamesLock;
+	static inline std::unordered_map<uint64, const CachedName*> NumberedNames;
+
+	/* Owns every string and CachedName */
+	static inline std::vector<std::unique_ptr<char[]>> ArenaBlocks;
+	static inline std::vector<std::unique_ptr<Page>> OwnedPages;
+	static inline std::deque<CachedName> OwnedNames;
+	static inline size_t ArenaBlockUsed = ArenaBlockSize;
+	static inline size_t ArenaBytes = 0x0;
+
+	static inline CacheCounters Counters;
+
+private:
+	static inline uint64 GetNumberedKey(int32 ComparisonIndex, uint32 Number)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(ComparisonIndex)) << 32) | Number;
+	}
+
+	/* Lock-free for names with Number == 0 */
+	static const CachedName* Find(int32 ComparisonIndex, uint32 Number);
+
+	/* Caller holds WriteLock */
+	static std::string_view StoreString(std::string_view String);
+	static const CachedName* DecodeAndStore(int32 ComparisonIndex, uint32 Number);
+
+public:
+	static void Enable();
+	static void Reset();
+
+	static inline bool IsEnabled() { return bIsEnabled.load(std::memory_order_acquire); }
+
+	static const CachedName& Get(int32 ComparisonIndex, uint32 Number);
+
+	static Stats GetStats();
+	static void LogStats();
+};
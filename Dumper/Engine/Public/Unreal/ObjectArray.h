@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <filesystem>
+#include <string_view>
+#include <shared_mutex>
 
 #include "Unreal/UnrealObjects.h"
 #include "OffsetFinder/Offsets.h"
@@ -33,10 +36,36 @@ private:
 
 	static inline uint8_t* (*DecryptPtr)(void* ObjPtr) = [](void* Ptr) -> uint8* { return static_cast<uint8*>(Ptr); };
 
+private:
+	struct NameIndexEntry
+	{
+		uint64 NameHash;
+		int32 ObjectIndex;
+	};
+
+	/* Every object of GObjects, sorted by the hash of its name and then by index. Only used once enabled through EnableNameIndex(). */
+	static inline std::shared_mutex NameIndexLock;
+	static inline std::vector<NameIndexEntry> NameIndex;
+	static inline int32 NumIndexedObjects = 0x0;
+	static inline std::atomic<bool> bIsNameIndexEnabled = false;
+	static inline std::atomic<bool> bIsNameIndexBuilt = false;
+
+	/* Incremented every time GObjects is (re-)initialized */
+	static inline std::atomic<uint32> InitGeneration = 0;
+
 private:
 	static void InitializeFUObjectItem(uint8_t* FirstItemPtr);
 	static void InitializeChunkSize(uint8_t* GObjects);
 
+	static inline uint64 HashName(std::string_view Name) { return std::hash<std::string_view>{}(Name); }
+
+	/* Caller holds NameIndexLock exclusively */
+	static void BuildNameIndex();
+
+	/* Lowest-index object named 'Name' for which 'Predicate' returns true, objects added after the index was built are scanned linearly */
+	template<typename PredicateType>
+	static UEObject FindByName(std::string_view Name, PredicateType&& Predicate);
+
 public:
 	static void InitDecryption(uint8_t* (*DecryptionFunction)(void* ObjPtr), const char* DecryptionLambdaAsStr);
 
@@ -45,6 +74,17 @@ public:
 	static void Init(int32 GObjectsOffset, const FFixedUObjectArrayLayout& ObjectArrayLayout = FFixedUObjectArrayLayout(), const char* const ModuleName = nullptr);
 	static void Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChunkedFixedUObjectArrayLayout& ObjectArrayLayout = FChunkedFixedUObjectArrayLayout(), const char* const ModuleName = nullptr);
 
+	/* Call once the offsets required to decode object names are final, the index is built in parallel on the next Find* call */
+	static void EnableNameIndex();
+
+	/* Rebuilds the index on the next Find* call, for when objects were created or garbage collected since it was built */
+	static void RebuildNameIndex();
+
+	/* Disables the index, lookups go back to linear scans */
+	static void ResetNameIndex();
+
+	static inline uint32 GetInitGeneration() { return InitGeneration.load(std::memory_order_acquire); }
+
 	static void DumpObjects(const fs::path& Path, bool bWithPathname = false);
 	static void DumpObjectsWithProperties(const fs::path& Path, bool bWithPathname = false);
 
@@ -92,6 +132,40 @@ public:
 	}
 };
 
+/* Class looked up by name, meant for function-local statics. A class that wasn't found is looked up again on the next call, a found one is kept until GObjects is re-initialized. */
+class CachedClassLookup
+{
+private:
+	const char* Name;
+	std::atomic<void*> Class = nullptr;
+	std::atomic<uint32> FoundInGeneration = 0; /* InitGeneration + 1 at the time the class was found, 0 if it wasn't found yet */
+
+public:
+	explicit CachedClassLookup(const char* ClassName)
+		: Name(ClassName)
+	{
+	}
+
+public:
+	inline UEClass Get()
+	{
+		const uint32 CurrentGeneration = ObjectArray::GetInitGeneration() + 1;
+
+		if (FoundInGeneration.load(std::memory_order_acquire) == CurrentGeneration)
+			return UEClass(Class.load(std::memory_order_relaxed));
+
+		UEClass Found = ObjectArray::FindClassFast(Name);
+
+		if (Found)
+		{
+			Class.store(Found.GetAddress(), std::memory_order_relaxed);
+			FoundInGeneration.store(CurrentGeneration, std::memory_order_release);
+		}
+
+		return Found;
+	}
+};
+
 #ifndef InitObjectArrayDecryption
 #define InitObjectArrayDecryption(DecryptionLambda) ObjectArray::InitDecryption(DecryptionLambda, #DecryptionLambda)
 #endif
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <string_view>
+#include <shared_mutex>
+
+#include "Unreal/Enums.h"
+#include "Unreal/CacheStats.h"
+
+class UEObject;
+
+/*
+* Dotted outer-chain path of every object that was used as an outer, e.g. "/Script/Engine.Actor" for members of AActor.
+*
+* GetFullName() and GetPathName() used to walk the outer chain of every object and prepend each outer's name to a temporary string.
+* Objects share their outers, so the path of an outer is assembled once, from the cached path of its own outer, and reused by all
+* objects inside of it. Entries are indexed by object index and validated against the object's address. string_views handed out stay
+* valid until ObjectPathCache::Reset() is called, which happens whenever GObjects or the FName system is (re-)initialized.
+*/
+class ObjectPathCache
+{
+public:
+	enum class EPathKind : uint8
+	{
+		/* UEObject::GetName() of every object in the chain */
+		Name = 0,
+
+		/* UEObject::GetNameWithPath() of every object in the chain */
+		NameWithPath = 1,
+
+		Num = 2
+	};
+
+	using Stats = CacheStats;
+
+private:
+	static constexpr size_t ArenaBlockSize = 0x40000;
+
+	struct CachedPath
+	{
+		const void* Object;
+		std::string_view Path;
+	};
+
+private:
+	static inline std::atomic<bool> bIsEnabled = false;
+
+	static inline std::shared_mutex Lock;
+
+	/* Indexed by object index, one table per EPathKind */
+	static inline std::vector<CachedPath> Paths[static_cast<uint8>(EPathKind::Num)];
+
+	/* Owns every path string */
+	static inline std::vector<std::unique_ptr<char[]>> ArenaBlocks;
+	static inline size_t ArenaBlockUsed = ArenaBlockSize;
+	static inline size_t ArenaBytes = 0x0;
+	static inline uint64 NumPaths = 0x0;
+
+	static inline CacheCounters Counters;
+
+private:
+	/* Caller holds Lock, shared or exclusive */
+	static std::string_view Find(UEObject Object, EPathKind Kind);
+
+	/* Caller holds Lock exclusively */
+	static std::string_view StoreString(std::string_view String);
+	static void Store(UEObject Object, EPathKind Kind, std::string_view Path);
+
+public:
+	static void Enable();
+	static void Reset();
+
+	static inline bool IsEnabled() { return bIsEnabled.load(std::memory_order_acquire); }
+
+	/* Names of all outers of 'Object' and of 'Object' itself, outermost first, separated by '.'. Empty if the path can't be cached. */
+	static std::string_view GetPath(UEObject Object, EPathKind Kind);
+
+	static Stats GetStats();
+	static void LogStats();
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <vector>
+
+#include "Unreal/ObjectArray.h"
+
+/*
+* Flat copy of the reflection data used by the generator, built in a single pass over GObjects.
+*
+* Every table is a structure-of-arrays. References between objects (outer, package, super, property types) are resolved to
+* GObjects-indices up front, so managers and generators can work on contiguous arrays instead of chasing pointers in game memory.
+* Handles (Address) are kept for everything that still has to be read from the object itself, like names or enum values.
+*/
+class ReflectionSnapshot
+{
+public:
+	static constexpr int32 InvalidIndex = -1;
+
+	/* Indexed by GObjects-index, entries for empty slots have Address == nullptr */
+	struct ObjectTable
+	{
+		std::vector<void*> Address;
+		std::vector<EClassCastFlags> CastFlags; // CastFlags of the objects' class
+		std::vector<EObjectFlags> Flags;
+		std::vector<int32> OuterIndex;
+		std::vector<int32> PackageIndex;
+		std::vector<int32> StructSlot; // Slot in StructTable, or InvalidIndex
+
+		inline int32 Num() const { return static_cast<int32>(Address.size()); }
+	};
+
+	/* One slot per UStruct (including classes and functions) */
+	struct StructTable
+	{
+		std::vector<int32> ObjectIndex;
+		std::vector<int32> SuperIndex;
+		std::vector<int32> Size;
+		std::vector<int32> MinAlignment;
+
+		/* Range into PropertyTable */
+		std::vector<int32> FirstProperty;
+		std::vector<int32> NumProperties;
+
+		/* Range into FunctionTable, only classes have functions */
+		std::vector<int32> FirstFunction;
+		std::vector<int32> NumFunctions;
+
+		inline int32 Num() const { return static_cast<int32>(ObjectIndex.size()); }
+	};
+
+	/* Properties of all structs, the properties of one struct are stored contiguously and in declaration order */
+	struct PropertyTable
+	{
+		std::vector<void*> Address;
+		std::vector<int32> OwnerSlot; // Slot in StructTable
+		std::vector<EClassCastFlags> CastFlags;
+		std::vector<int32> Offset;
+		std::vector<int32> Size;
+		std::vector<int32> ArrayDim;
+		std::vector<int32> Alignment;
+
+		/* GObjects-index of the UStruct (StructProperty), UEnum (Byte-/EnumProperty) or UClass (ObjectProperty) this property refers to */
+		std::vector<int32> TypeIndex;
+
+		inline int32 Num() const { return static_cast<int32>(Address.size()); }
+	};
+
+	struct FunctionTable
+	{
+		std::vector<int32> ObjectIndex;
+		std::vector<int32> OwnerSlot; // Slot of the owning class in StructTable
+		std::vector<EFunctionFlags> FunctionFlags;
+
+		inline int32 Num() const { return static_cast<int32>(ObjectIndex.size()); }
+	};
+
+	struct EnumTable
+	{
+		std::vector<int32> ObjectIndex;
+
+		inline int32 Num() const { return static_cast<int32>(ObjectIndex.size()); }
+	};
+
+private:
+	static inline ObjectTable Objects;
+	static inline StructTable Structs;
+	static inline PropertyTable Properties;
+	static inline FunctionTable Functions;
+	static inline EnumTable Enums;
+
+	static inline bool bIsInitialized = false;
+
+private:
+	/* 'Index' if it is a slot of the object table, else InvalidIndex */
+	static inline int32 ToObjectIndex(int32 Index)
+	{
+		return Index >= 0 && Index < Objects.Num() ? Index : InvalidIndex;
+	}
+
+	static void AddStruct(UEStruct Struct, int32 ObjectIndex);
+	static void ResolvePackageIndices();
+
+public:
+	static void Init();
+	static void Reset();
+
+	static inline bool IsInitialized() { return bIsInitialized; }
+
+public:
+	static inline const ObjectTable& GetObjects() { return Objects; }
+	static inline const StructTable& GetStructs() { return Structs; }
+	static inline const PropertyTable& GetProperties() { return Properties; }
+	static inline const FunctionTable& GetFunctions() { return Functions; }
+	static inline const EnumTable& GetEnums() { return Enums; }
+
+public:
+	static inline bool IsA(int32 ObjectIndex, EClassCastFlags TypeFlags)
+	{
+		return TypeFlags == EClassCastFlags::None || (Objects.CastFlags[ObjectIndex] & TypeFlags);
+	}
+
+	static inline int32 GetStructSlot(int32 ObjectIndex)
+	{
+		return ObjectIndex >= 0 && ObjectIndex < Objects.Num() ? Objects.StructSlot[ObjectIndex] : InvalidIndex;
+	}
+
+	template<typename UEType = UEObject>
+	static inline UEType GetObject(int32 ObjectIndex)
+	{
+		return UEType(Objects.Address[ObjectIndex]);
+	}
+
+	/* Same as UEStruct::HasType(), walks the super-chain in the snapshot */
+	static bool HasType(int32 StructSlot, int32 TypeObjectIndex);
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <span>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <shared_mutex>
+
+#include "Unreal/UnrealObjects.h"
+#include "Unreal/CacheStats.h"
+
+/*
+* Flat arrays of the properties and functions of every struct that was asked for them, e.g. the members of AActor.
+*
+* The Children/ChildProperties lists of a struct are linked lists spread all over the heap. Managers and generators walk the same
+* struct several times, so the first request copies the list into a bump arena and every following request gets a span into it.
+* Entries are indexed by object index and validated against the struct's address. Views handed out stay valid until
+* StructChildCache::Reset() is called, which happens whenever GObjects is (re-)initialized. While the cache is disabled, or if it
+* was reset during a lookup, the returned list owns a copy of the children instead.
+*/
+class StructChildCache
+{
+public:
+	using Stats = CacheStats;
+
+private:
+	/* Number of elements per arena block, each element is a single pointer */
+	static constexpr size_t ArenaBlockSize = 0x8000;
+
+	struct CachedSpan
+	{
+		const void* Struct;
+		const void* Data;
+		int32 Num;
+	};
+
+	template<typename UEType>
+	struct TChildTable
+	{
+		/* Indexed by object index */
+		std::vector<CachedSpan> Spans;
+
+		/* Owns every element the spans point to */
+		std::vector<std::unique_ptr<UEType[]>> ArenaBlocks;
+		size_t ArenaBlockUsed;
+	};
+
+private:
+	static inline std::atomic<bool> bIsEnabled = false;
+
+	static inline std::shared_mutex Lock;
+
+	static inline TChildTable<UEProperty> Properties = {};
+	static inline TChildTable<UEFunction> Functions = {};
+
+	static inline uint64 NumStructs = 0x0;
+	static inline uint64 ArenaBytes = 0x0;
+
+	static inline CacheCounters Counters;
+
+private:
+	template<typename UEType>
+	static TCachedChildList<UEType> GetChildren(UEStruct Struct, TChildTable<UEType>& Table, const TStructChildRange<UEType>& Children);
+
+	template<typename UEType>
+	static void ResetTable(TChildTable<UEType>& Table);
+
+public:
+	static void Enable();
+	static void Reset();
+
+	static inline bool IsEnabled() { return bIsEnabled.load(std::memory_order_acquire); }
+
+	static TCachedChildList<UEProperty> GetProperties(UEStruct Struct);
+	static TCachedChildList<UEFunction> GetFunctions(UEStruct Struct);
+
+	static Stats GetStats();
+	static void LogStats();
+};
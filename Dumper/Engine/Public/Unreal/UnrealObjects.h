@@ -1,6 +1,8 @@
 #pragma once
 
+#include <span>
 #include <vector>
+#include <iterator>
 #include <unordered_map>
 
 #include "Unreal/Enums.h"
@@ -180,6 +182,107 @@ public:
 	std::string GetEnumTypeAsStr() const;
 };
 
+/* Position in the Children (UField) or ChildProperties (FField) list of a struct, only ever rests on fields matching 'TypeFlags' */
+class StructChildCursor
+{
+protected:
+	void* Current;
+	EClassCastFlags TypeFlags;
+	bool bIsFField;
+
+public:
+	StructChildCursor(void* FirstField, EClassCastFlags Flags, bool bIsFFieldList)
+		: Current(FirstField), TypeFlags(Flags), bIsFField(bIsFFieldList)
+	{
+		SkipNonMatching();
+	}
+
+protected:
+	void Advance();
+	void SkipNonMatching();
+
+public:
+	inline bool operator==(const StructChildCursor& Other) const { return Current == Other.Current; }
+	inline bool operator!=(const StructChildCursor& Other) const { return Current != Other.Current; }
+};
+
+/* Lazy view over the children of a struct, yields every child of type 'UEType' without allocating. Only valid as long as the struct is. */
+template<typename UEType>
+class TStructChildRange
+{
+public:
+	class Iterator : public StructChildCursor
+	{
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = UEType;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = UEType;
+
+	public:
+		using StructChildCursor::StructChildCursor;
+
+		inline UEType operator*() const { return UEType(Current); }
+
+		inline Iterator& operator++() { Advance(); return *this; }
+		inline Iterator operator++(int) { Iterator Old = *this; Advance(); return Old; }
+	};
+
+private:
+	void* FirstField;
+	EClassCastFlags TypeFlags;
+	bool bIsFField;
+
+public:
+	TStructChildRange(void* First, EClassCastFlags Flags, bool bIsFFieldList)
+		: FirstField(First), TypeFlags(Flags), bIsFField(bIsFFieldList)
+	{
+	}
+
+public:
+	inline Iterator begin() const { return Iterator(FirstField, TypeFlags, bIsFField); }
+	inline Iterator end() const { return Iterator(nullptr, TypeFlags, bIsFField); }
+
+	inline bool IsEmpty() const { return begin() == end(); }
+};
+
+/* Children returned by UEStruct::GetCachedProperties()/GetCachedFunctions(), a view into StructChildCache or an owned copy if the struct wasn't cached */
+template<typename UEType>
+class TCachedChildList
+{
+private:
+	std::vector<UEType> OwnedChildren;
+	std::span<const UEType> Children;
+
+public:
+	TCachedChildList(std::span<const UEType> CachedChildren)
+		: Children(CachedChildren)
+	{
+	}
+
+	TCachedChildList(std::vector<UEType>&& CopiedChildren)
+		: OwnedChildren(std::move(CopiedChildren)), Children(OwnedChildren)
+	{
+	}
+
+	/* Moving a vector keeps its buffer, so 'Children' stays valid. A copy would have to re-point it. */
+	TCachedChildList(TCachedChildList&&) = default;
+	TCachedChildList& operator=(TCachedChildList&&) = default;
+
+	TCachedChildList(const TCachedChildList&) = delete;
+	TCachedChildList& operator=(const TCachedChildList&) = delete;
+
+public:
+	inline auto begin() const { return Children.begin(); }
+	inline auto end() const { return Children.end(); }
+
+	inline size_t size() const { return Children.size(); }
+	inline bool empty() const { return Children.empty(); }
+
+	inline UEType operator[](size_t Index) const { return Children[Index]; }
+};
+
 class UEStruct : public UEField
 {
 	using UEField::UEField;
@@ -196,6 +299,14 @@ public:
 	std::vector<UEProperty> GetProperties() const;
 	std::vector<UEFunction> GetFunctions() const;
 
+	/* Walk the child lists on every iteration, prefer these over GetProperties()/GetFunctions() for a single pass */
+	TStructChildRange<UEProperty> IterateProperties() const;
+	TStructChildRange<UEFunction> IterateFunctions() const;
+
+	/* Flat copy of the child lists, built once per struct, see StructChildCache */
+	TCachedChildList<UEProperty> GetCachedProperties() const;
+	TCachedChildList<UEFunction> GetCachedFunctions() const;
+
 	UEProperty FindMember(const std::string& MemberName, EClassCastFlags TypeFlags = EClassCastFlags::None) const;
 
 	bool HasMembers() const;
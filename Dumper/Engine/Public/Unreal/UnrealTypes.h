@@ -65,6 +65,9 @@ private:
 
 class FName
 {
+private:
+	friend class OffsetCache;
+
 public:
 	enum class EOffsetOverrideType
 	{
@@ -102,6 +105,14 @@ public:
 	std::string ToRawString() const;
 	std::string ToValidString() const;
 
+	/*
+	* Views into the NameCache, valid until the cache is reset.
+	* Before the cache is enabled the name is decoded into a thread_local buffer, which the next call on the same thread overwrites.
+	*/
+	std::string_view ToStringView() const;
+	std::string_view ToRawStringView() const;
+	std::string_view ToValidStringView() const;
+
 	int32 GetCompIdx() const;
 	uint32 GetNumber() const;
 
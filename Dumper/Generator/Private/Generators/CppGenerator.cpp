@@ -1,13 +1,20 @@
 
 #include <vector>
 #include <array>
+#include <atomic>
+#include <thread>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
 
 #include "Unreal/ObjectArray.h"
+#include "Unreal/ReflectionSnapshot.h"
 #include "Generators/CppGenerator.h"
 #include "Wrappers/MemberWrappers.h"
 #include "Managers/MemberManager.h"
 
 #include "Settings.h"
+#include "Menu/Logger.h"
 
 constexpr std::string GetTypeFromSize(uint8 Size)
 {
@@ -466,11 +473,12 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 {
 	namespace CppSettings = Settings::CppGenerator;
 
-	static PredefinedFunction StaticClass;
-	static PredefinedFunction GetDefaultObj;
+	/* The bodies of 'StaticClass' and 'GetDefaultObj' are rewritten for every class, so every package-worker needs its own copy */
+	static thread_local PredefinedFunction StaticClass;
+	static thread_local PredefinedFunction GetDefaultObj;
 
-	static PredefinedFunction Interface_AsObject;
-	static PredefinedFunction Interface_AsObject_Const;
+	static thread_local PredefinedFunction Interface_AsObject;
+	static thread_local PredefinedFunction Interface_AsObject_Const;
 
 	if (StaticClass.NameWithParams.empty())
 		StaticClass = {
@@ -577,17 +585,14 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 	std::string NameText = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, Name) : std::format("\"{}\"", Name);
 	
 
-	static UEClass BPGeneratedClass = nullptr;
-	
-	if (BPGeneratedClass == nullptr)
-		BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
+	static CachedClassLookup BPGeneratedClass("BlueprintGeneratedClass");
 
 
 	const char* StaticClassImplFunctionName = "StaticClassImpl";
 
 	std::string NonFullName;
 
-	const bool bIsBPStaticClass = Struct.IsAClassWithType(BPGeneratedClass);
+	const bool bIsBPStaticClass = Struct.IsAClassWithType(BPGeneratedClass.Get());
 
 	/* BPGenerated classes are loaded/unloaded dynamically, so a static pointer to the UClass will eventually be invalidated */
 	if (bIsBPStaticClass)
@@ -723,10 +728,10 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 		const int32 StructSize = Struct.GetSize();
 
 		// Alignment assertions
-		StructFile << std::format("static_assert(alignof({}) == 0x{:06X}, \"Wrong alignment on {}\");\n", UniquePrefixedName, Struct.GetAlignment(), UniquePrefixedName);
+		StructFile.Format("static_assert(alignof({}) == 0x{:06X}, \"Wrong alignment on {}\");\n", UniquePrefixedName, Struct.GetAlignment(), UniquePrefixedName);
 
 		// Size assertions
-		StructFile << std::format("static_assert(sizeof({}) == 0x{:06X}, \"Wrong size on {}\");\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1), UniquePrefixedName);
+		StructFile.Format("static_assert(sizeof({}) == 0x{:06X}, \"Wrong size on {}\");\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1), UniquePrefixedName);
 	}
 
 
@@ -741,7 +746,7 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 
 			std::string MemberName = Member.GetName();
 
-			StructFile << std::format("static_assert(offsetof({0}, {1}) == 0x{2:06X}, \"Member '{0}::{1}' has a wrong offset!\");\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
+			StructFile.Format("static_assert(offsetof({0}, {1}) == 0x{2:06X}, \"Member '{0}::{1}' has a wrong offset!\");\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
 		}
 	}
 }
@@ -822,15 +827,6 @@ std::string CppGenerator::GetEnumUnderlayingType(const EnumWrapper& Enum)
 
 std::string CppGenerator::GetCycleFixupType(const StructWrapper& Struct, bool bIsForInheritance)
 {
-	static int32 UObjectSize = 0x0;
-	static int32 AActorSize = 0x0;
-
-	if (UObjectSize == 0x0 || AActorSize == 0x0)
-	{
-		UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
-		AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
-	}
-
 	/* Predefined structs can not be cyclic, unless you did something horribly wrong when defining the predefined struct! */
 	if (!Struct.IsUnrealStruct())
 		return "Invalid+Fixup+Type";
@@ -1069,7 +1065,9 @@ std::string CppGenerator::GetFunctionSignature(UEFunction Func)
 
 	bool bIsFirstParam = true;
 
-	std::vector<UEProperty> Params = Func.GetProperties();
+	const TCachedChildList<UEProperty> CachedParams = Func.GetCachedProperties();
+
+	std::vector<UEProperty> Params(CachedParams.begin(), CachedParams.end());
 	std::sort(Params.begin(), Params.end(), CompareUnrealProperties);
 
 	for (UEProperty Param : Params)
@@ -1122,21 +1120,17 @@ std::unordered_map<std::string, UEProperty> CppGenerator::GetUnknownProperties()
 {
 	std::unordered_map<std::string, UEProperty> PropertiesWithNames;
 
-	for (UEObject Obj : ObjectArray())
-	{
-		if (!Obj.IsA(EClassCastFlags::Struct))
-			continue;
+	const ReflectionSnapshot::PropertyTable& Properties = ReflectionSnapshot::GetProperties();
 
-		for (UEProperty Prop : Obj.Cast<UEStruct>().GetProperties())
-		{
-			std::string TypeName = GetMemberTypeString(Prop);
+	for (int32 i = 0; i < Properties.Num(); i++)
+	{
+		UEProperty Prop = Properties.Address[i];
 
-			auto [Class, FieldClass] = Prop.GetClass();
+		std::string TypeName = GetMemberTypeString(Prop);
 
-			/* Relies on unknown names being post-fixed with an underscore by 'GetMemberTypeString()' */
-			if (TypeName.back() == '_')
-				PropertiesWithNames[TypeName] = Prop;
-		}
+		/* Relies on unknown names being post-fixed with an underscore by 'GetMemberTypeString()' */
+		if (TypeName.back() == '_')
+			PropertiesWithNames[TypeName] = Prop;
 	}
 
 	return PropertiesWithNames;
@@ -1150,7 +1144,7 @@ void CppGenerator::GeneratePropertyFixupFile(StreamType& PropertyFixup)
 
 	for (const auto& [Name, Property] : UnknownProperties)
 	{
-		PropertyFixup << std::format("\nclass alignas(0x{:02X}) {}\n{{\n\tunsigned __int8 Pad[0x{:X}];\n}};\n",Property.GetAlignment(), Name, Property.GetSize());
+		PropertyFixup.Format("\nclass alignas(0x{:02X}) {}\n{{\n\tunsigned __int8 Pad[0x{:X}];\n}};\n",Property.GetAlignment(), Name, Property.GetSize());
 	}
 
 	WriteFileEnd(PropertyFixup, EFileType::PropertyFixup);
@@ -1167,7 +1161,7 @@ void CppGenerator::GenerateEnumFwdDeclarations(StreamType& ClassOrStructFile, Pa
 
 		EnumWrapper Enum = EnumWrapper(ObjectArray::GetByIndex<UEEnum>(EnumIndex));
 
-		ClassOrStructFile << std::format("enum class {} : {};\n", GetEnumPrefixedName(Enum), GetEnumUnderlayingType(Enum));
+		ClassOrStructFile.Format("enum class {} : {};\n", GetEnumPrefixedName(Enum), GetEnumUnderlayingType(Enum));
 	}
 }
 
@@ -1224,7 +1218,7 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 
 		bHasSingleLineForwardDeclarations = true;
 
-		NameCollisionsFile << std::format("\nnamespace {} {{ {} }}\n", PackageName, ForwardDeclString.c_str() + 1);
+		NameCollisionsFile.Format("\nnamespace {} {{ {} }}\n", PackageName, ForwardDeclString.c_str() + 1);
 	}
 
 	if (bHasSingleLineForwardDeclarations)
@@ -1256,21 +1250,21 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		DependencyManager::OnVisitCallbackType GenerateStructAssertionsCallback = [&AssertionStream](int32 Index) -> void
+		auto GenerateStructAssertionsCallback = [&AssertionStream](int32 Index) -> void
 		{
 			StructWrapper Struct = ObjectArray::GetByIndex<UEStruct>(Index);
 
 			std::string UniquePrefixedName = GetStructPrefixedName(Struct);
 
-			AssertionStream << std::format("// {} {}\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName);
+			AssertionStream.Format("// {} {}\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName);
 
 			// Alignment assertions
-			AssertionStream << std::format("static_assert(alignof({}) == 0x{:06X});\n", UniquePrefixedName, Struct.GetAlignment());
+			AssertionStream.Format("static_assert(alignof({}) == 0x{:06X});\n", UniquePrefixedName, Struct.GetAlignment());
 
 			const int32 StructSize = Struct.GetSize();
 
 			// Size assertions
-			AssertionStream << std::format("static_assert(sizeof({}) == 0x{:06X});\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1));
+			AssertionStream.Format("static_assert(sizeof({}) == 0x{:06X});\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1));
 
 			AssertionStream << "\n";
 
@@ -1282,7 +1276,7 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 				if (Member.IsStatic() || Member.IsZeroSizedMember() || Member.IsBitField())
 					continue;
 
-				AssertionStream << std::format("static_assert(offsetof({}, {}) == 0x{:06X});\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
+				AssertionStream.Format("static_assert(offsetof({}, {}) == 0x{:06X});\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
 			}
 
 			AssertionStream << "\n\n";
@@ -1319,10 +1313,10 @@ void CppGenerator::GenerateSDKHeader(StreamType& SdkHpp)
 		const bool bHasStructsFile = (CurrentPackage.HasStructs() || CurrentPackage.HasEnums());
 
 		if (bIsStruct && bHasStructsFile)
-			SdkHpp << std::format("#include \"SDK/{}_structs.hpp\"\n", CurrentPackage.GetName());
+			SdkHpp.Format("#include \"SDK/{}_structs.hpp\"\n", CurrentPackage.GetName());
 
 		if (!bIsStruct && bHasClassesFile)
-			SdkHpp << std::format("#include \"SDK/{}_classes.hpp\"\n", CurrentPackage.GetName());
+			SdkHpp.Format("#include \"SDK/{}_classes.hpp\"\n", CurrentPackage.GetName());
 	};
 
 	PackageManager::IterateDependencies(ForEachElementCallback);
@@ -1348,10 +1342,10 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 )";
 
 	if (Type == EFileType::SdkHpp)
-		File << std::format("\n// {}\n// {}\n", Settings::Generator::GameName, Settings::Generator::GameVersion);
+		File.Format("\n// {}\n// {}\n", Settings::Generator::GameName, Settings::Generator::GameVersion);
 	
 
-	File << std::format("\n// {}\n\n", Package.IsValidHandle() ? std::format("Package: {}", Package.GetName()) : CustomFileComment);
+	File.Format("\n// {}\n\n", Package.IsValidHandle() ? std::format("Package: {}", Package.GetName()) : CustomFileComment);
 
 
 	if (!CustomIncludes.empty())
@@ -1385,10 +1379,10 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 		File << "\n";
 
 		if (Package.HasClasses())
-			File << std::format("#include \"{}_classes.hpp\"\n", PackageName);
+			File.Format("#include \"{}_classes.hpp\"\n", PackageName);
 
 		if (Package.HasParameterStructs())
-			File << std::format("#include \"{}_parameters.hpp\"\n", PackageName);
+			File.Format("#include \"{}_parameters.hpp\"\n", PackageName);
 
 		File << "\n";
 	}
@@ -1408,10 +1402,10 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 			std::string DependencyName = PackageManager::GetName(PackageIndex);
 
 			if (Requirements.bShouldIncludeStructs)
-				File << std::format("#include \"{}_structs.hpp\"\n", DependencyName);
+				File.Format("#include \"{}_structs.hpp\"\n", DependencyName);
 
 			if (Requirements.bShouldIncludeClasses)
-				File << std::format("#include \"{}_classes.hpp\"\n", DependencyName);
+				File.Format("#include \"{}_classes.hpp\"\n", DependencyName);
 		}
 
 		if (bAddNewLine)
@@ -1426,17 +1420,17 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 
 	if constexpr (CppSettings::SDKNamespaceName)
 	{
-		File << std::format("namespace {}", CppSettings::SDKNamespaceName);
+		File.Format("namespace {}", CppSettings::SDKNamespaceName);
 
 		if (Type == EFileType::Parameters && CppSettings::ParamNamespaceName)
-			File << std::format("::{}", CppSettings::ParamNamespaceName);
+			File.Format("::{}", CppSettings::ParamNamespaceName);
 
 		File << "\n{\n";
 	}
 	else if constexpr (CppSettings::ParamNamespaceName)
 	{
 		if (Type == EFileType::Parameters)
-			File << std::format("namespace {}\n{{\n", CppSettings::ParamNamespaceName);
+			File.Format("namespace {}\n{{\n", CppSettings::ParamNamespaceName);
 	}
 }
 
@@ -1458,6 +1452,10 @@ void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
 
 void CppGenerator::Generate()
 {
+	/* Read by GetCycleFixupType() from all package-workers, so they need to be set before any worker is started */
+	UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
+	AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
+
 	// Generate SDK.hpp with sorted packages
 	StreamType SdkHpp(MainFolder / "SDK.hpp");
 	GenerateSDKHeader(SdkHpp);
@@ -1492,116 +1490,207 @@ void CppGenerator::Generate()
 	}
 
 	// Generates all packages and writes them to files
+	std::vector<PackageInfoHandle> Packages;
+
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		if (Package.IsEmpty())
-			continue;
+		if (!Package.IsEmpty())
+			Packages.push_back(Package);
+	}
 
-		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
-		const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
+	/* Largest packages first, so a single huge package doesn't end up being started last */
+	auto GetPackageWeight = [](const PackageInfoHandle& Package) -> size_t
+	{
+		return Package.GetSortedStructs().GetNumEntries() + Package.GetSortedClasses().GetNumEntries() + Package.GetEnums().size() + Package.GetFunctions().size();
+	};
 
-		StreamType ClassesFile;
-		StreamType StructsFile;
-		StreamType ParametersFile;
-		StreamType FunctionsFile;
+	std::stable_sort(Packages.begin(), Packages.end(), [&](const PackageInfoHandle& Left, const PackageInfoHandle& Right)
+	{
+		return GetPackageWeight(Left) > GetPackageWeight(Right);
+	});
 
-		/* Create files and handles namespaces and includes */
-		if (Package.HasClasses())
-		{
-			ClassesFile = StreamType(Subfolder / (U8FileName + u8"_classes.hpp"));
+	/* Every package only writes to its own files and only reads from the managers, idle workers take the next package from the queue */
+	std::atomic<size_t> NextPackage = 0x0;
 
-			if (!ClassesFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
+	auto GeneratePackagesWorker = [&]() -> void
+	{
+		for (size_t i = NextPackage++; i < Packages.size(); i = NextPackage++)
+			GeneratePackage(Packages[i], Subfolder);
+	};
 
-			WriteFileHead(ClassesFile, Package, EFileType::Classes);
+	const uint32 NumThreads = std::max(1u, std::min(std::thread::hardware_concurrency(), static_cast<uint32>(Packages.size())));
 
-			/* Write enum foward declarations before all of the classes */
-			GenerateEnumFwdDeclarations(ClassesFile, Package, true);
-		}
+	std::vector<std::thread> Workers;
+	Workers.reserve(NumThreads - 1);
 
-		if (Package.HasStructs() || Package.HasEnums())
-		{
-			StructsFile = StreamType(Subfolder / (U8FileName + u8"_structs.hpp"));
+	for (uint32 i = 1; i < NumThreads; i++)
+		Workers.emplace_back(GeneratePackagesWorker);
 
-			if (!StructsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
+	GeneratePackagesWorker();
 
-			WriteFileHead(StructsFile, Package, EFileType::Structs);
+	for (std::thread& Worker : Workers)
+		Worker.join();
 
-			/* Write enum foward declarations before all of the structs */
-			GenerateEnumFwdDeclarations(StructsFile, Package, false);
-		}
+	if constexpr (Settings::Debug::bVerifyParallelPackageGeneration)
+		VerifyParallelPackageOutput(Packages);
+}
 
-		if (Package.HasParameterStructs())
-		{
-			ParametersFile = StreamType(Subfolder / (U8FileName + u8"_parameters.hpp"));
+bool CppGenerator::VerifyParallelPackageOutput(const std::vector<PackageInfoHandle>& Packages)
+{
+	const fs::path SerialFolder = MainFolder / "SerialCheck";
 
-			if (!ParametersFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+	std::error_code Error;
+	fs::remove_all(SerialFolder, Error);
 
-			WriteFileHead(ParametersFile, Package, EFileType::Parameters);
-		}
+	if (!fs::create_directories(SerialFolder, Error))
+	{
+		LogError("VerifyParallelPackageOutput: Failed to create \"%s\"", SerialFolder.string().c_str());
+		return false;
+	}
 
-		if (Package.HasFunctions())
-		{
-			FunctionsFile = StreamType(Subfolder / (U8FileName + u8"_functions.cpp"));
+	for (const PackageInfoHandle& Package : Packages)
+		GeneratePackage(Package, SerialFolder);
 
-			if (!FunctionsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
+	auto ReadFile = [](const fs::path& FilePath) -> std::string
+	{
+		std::ifstream File(FilePath, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	};
 
-			WriteFileHead(FunctionsFile, Package, EFileType::Functions);
-		}
+	int32 NumFiles = 0x0;
+	int32 NumMismatches = 0x0;
 
-		const int32 PackageIndex = Package.GetIndex();
+	for (const fs::directory_entry& SerialFile : fs::directory_iterator(SerialFolder, Error))
+	{
+		const fs::path ParallelFile = Subfolder / SerialFile.path().filename();
 
-		/* 
-		* Generate classes/structs/enums/functions directly into the respective files
-		* 
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
+		if (!fs::exists(ParallelFile, Error) || ReadFile(SerialFile.path()) != ReadFile(ParallelFile))
 		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
+			LogError("VerifyParallelPackageOutput: \"%s\" differs from the single-threaded output", ParallelFile.filename().string().c_str());
+			NumMismatches++;
 		}
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+		NumFiles++;
+	}
 
-			DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+	fs::remove_all(SerialFolder, Error);
 
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	if (NumMismatches > 0x0)
+	{
+		LogError("VerifyParallelPackageOutput: %d of %d package files differ", NumMismatches, NumFiles);
+		return false;
+	}
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+	LogSuccess("VerifyParallelPackageOutput: all %d package files are identical to the single-threaded output", NumFiles);
+	return true;
+}
 
-			DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+void CppGenerator::GeneratePackage(PackageInfoHandle Package, const fs::path& PackageFolder)
+{
+	const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+	const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
 
-			Classes.VisitAllNodesWithCallback(GenerateClassCallback);
-		}
+	StreamType ClassesFile;
+	StreamType StructsFile;
+	StreamType ParametersFile;
+	StreamType FunctionsFile;
+
+	/* Create files and handles namespaces and includes */
+	if (Package.HasClasses())
+	{
+		ClassesFile = StreamType(PackageFolder / (U8FileName + u8"_classes.hpp"));
 
+		if (!ClassesFile.is_open())
+			LogError("Error opening file \"%s\"", (FileName + "_classes.hpp").c_str());
 
-		/* Closes any namespaces if required */
-		if (Package.HasClasses())
-			WriteFileEnd(ClassesFile, EFileType::Classes);
+		WriteFileHead(ClassesFile, Package, EFileType::Classes);
 
-		if (Package.HasStructs() || Package.HasEnums())
-			WriteFileEnd(StructsFile, EFileType::Structs);
+		/* Write enum foward declarations before all of the classes */
+		GenerateEnumFwdDeclarations(ClassesFile, Package, true);
+	}
 
-		if (Package.HasParameterStructs())
-			WriteFileEnd(ParametersFile, EFileType::Parameters);
+	if (Package.HasStructs() || Package.HasEnums())
+	{
+		StructsFile = StreamType(PackageFolder / (U8FileName + u8"_structs.hpp"));
+
+		if (!StructsFile.is_open())
+			LogError("Error opening file \"%s\"", (FileName + "_structs.hpp").c_str());
+
+		WriteFileHead(StructsFile, Package, EFileType::Structs);
+
+		/* Write enum foward declarations before all of the structs */
+		GenerateEnumFwdDeclarations(StructsFile, Package, false);
+	}
+
+	if (Package.HasParameterStructs())
+	{
+		ParametersFile = StreamType(PackageFolder / (U8FileName + u8"_parameters.hpp"));
+
+		if (!ParametersFile.is_open())
+			LogError("Error opening file \"%s\"", (FileName + "_parameters.hpp").c_str());
+
+		WriteFileHead(ParametersFile, Package, EFileType::Parameters);
+	}
+
+	if (Package.HasFunctions())
+	{
+		FunctionsFile = StreamType(PackageFolder / (U8FileName + u8"_functions.cpp"));
+
+		if (!FunctionsFile.is_open())
+			LogError("Error opening file \"%s\"", (FileName + "_functions.cpp").c_str());
 
-		if (Package.HasFunctions())
-			WriteFileEnd(FunctionsFile, EFileType::Functions);
+		WriteFileHead(FunctionsFile, Package, EFileType::Functions);
 	}
+
+	const int32 PackageIndex = Package.GetIndex();
+
+	/* 
+	* Generate classes/structs/enums/functions directly into the respective files
+	* 
+	* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
+	*/
+	for (int32 EnumIdx : Package.GetEnums())
+	{
+		GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
+	}
+
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
+
+		auto GenerateStructCallback = [&](int32 Index) -> void
+		{
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
+		};
+
+		Structs.VisitAllNodesWithCallback(GenerateStructCallback);
+	}
+
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+
+		auto GenerateClassCallback = [&](int32 Index) -> void
+		{
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
+		};
+
+		Classes.VisitAllNodesWithCallback(GenerateClassCallback);
+	}
+
+
+	/* Closes any namespaces if required */
+	if (Package.HasClasses())
+		WriteFileEnd(ClassesFile, EFileType::Classes);
+
+	if (Package.HasStructs() || Package.HasEnums())
+		WriteFileEnd(StructsFile, EFileType::Structs);
+
+	if (Package.HasParameterStructs())
+		WriteFileEnd(ParametersFile, EFileType::Parameters);
+
+	if (Package.HasFunctions())
+		WriteFileEnd(FunctionsFile, EFileType::Functions);
 }
 
 void CppGenerator::InitPredefinedMembers()
@@ -2187,13 +2276,27 @@ void CppGenerator::InitPredefinedFunctions()
 
 	PredefinedElements& UObjectPredefs = PredefinedMembers[ObjectArray::FindClassFast("Object").GetIndex()];
 
-	UObjectPredefs.Functions =
+	constexpr const char* FindObjectImplBody = Settings::CppGenerator::bAddObjectLookupIndex ?
+R"({
+	/* 'Class Package.Outer.Name', the name itself might contain a '.' so every part following one is a possible name */
+	const size_t ClassNameEnd = FullName.find(' ');
+
+	if (ClassNameEnd == std::string::npos)
+		return nullptr;
+
+	auto IsMatchingObject = [&](UObject* Object) -> bool
 	{
-		/* static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Finds a UObject in the global object array by full-name, optionally with ECastFlags to reduce heavy string comparison",
-			.ReturnType = "class UObject*", .NameWithParams = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body =
+		return Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName;
+	};
+
+	for (size_t NameStart = FullName.rfind('.'); NameStart != std::string::npos && NameStart > ClassNameEnd; NameStart = FullName.rfind('.', NameStart - 1))
+	{
+		if (UObject* Object = BasicFilesImpleUtils::FindObjectByName(FullName.substr(NameStart + 1), IsMatchingObject))
+			return Object;
+	}
+
+	return BasicFilesImpleUtils::FindObjectByName(FullName.substr(ClassNameEnd + 1), IsMatchingObject);
+})" :
 R"({
 	for (int i = 0; i < GObjects->Num(); ++i)
 	{
@@ -2207,13 +2310,12 @@ R"({
 	}
 
 	return nullptr;
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison",
-			.ReturnType = "class UObject*", .NameWithParams = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body =
+})";
+
+	constexpr const char* FindObjectFastImplBody = Settings::CppGenerator::bAddObjectLookupIndex ?
+R"({
+	return BasicFilesImpleUtils::FindObjectByName(Name, [RequiredType](UObject* Object) -> bool { return Object->HasTypeFlag(RequiredType); });
+})" :
 R"({
 	for (int i = 0; i < GObjects->Num(); ++i)
 	{
@@ -2227,7 +2329,23 @@ R"({
 	}
 
 	return nullptr;
-})",
+})";
+
+	UObjectPredefs.Functions =
+	{
+		/* static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Finds a UObject in the global object array by full-name, optionally with ECastFlags to reduce heavy string comparison",
+			.ReturnType = "class UObject*", .NameWithParams = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None)",
+			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body =
+FindObjectImplBody,
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison",
+			.ReturnType = "class UObject*", .NameWithParams = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)",
+			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body =
+FindObjectFastImplBody,
 			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
 		},
 
@@ -2387,12 +2505,9 @@ R"({
 	{
 		if (Clss->GetName() != ClassName)
 			continue;
-			
-		for (UField* Field = Clss->Children; Field; Field = Field->Next)
-		{
-			if(Field->HasTypeFlag(EClassCastFlags::Function) && Field->GetName() == FuncName)
-				return static_cast<class UFunction*>(Field);
-		}
+
+		if (UFunction* Func = BasicFilesImpleUtils::FindFunctionInClass(Clss, FuncName))
+			return Func;
 	}
 
 	return nullptr;
@@ -2913,7 +3028,14 @@ void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp
 )";
 
 	WriteFileHead(BasicHpp, nullptr, EFileType::BasicHpp, "Basic file containing structs required by the SDK", CustomIncludes);
-	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", "#include <Windows.h>");
+	constexpr const char* BasicCppIncludes = R"(#include <Windows.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <shared_mutex>
+#include <unordered_map>)";
+
+	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", BasicCppIncludes);
 
 
 	/* use namespace of UnrealContainers */
@@ -2942,6 +3064,14 @@ namespace Offsets
 }}
 )", Off::InSDK::ObjArray::GObjects, Off::InSDK::Name::AppendNameToString, Off::InSDK::NameArray::GNames, Off::InSDK::World::GWorld, Off::InSDK::ProcessEvent::PEOffset, Off::InSDK::ProcessEvent::PEIndex);
 
+	/* Build flag of the SDK, can be overwritten by defining it before including SDK.hpp */
+	BasicHpp << std::format(R"(
+/* Set to 1 to build the function table of every class on a background thread once GObjects was initialized, instead of on the first call of a function of that class */
+#ifndef SDK_PREWARM_FUNCTION_TABLES
+#define SDK_PREWARM_FUNCTION_TABLES {}
+#endif
+)", CppSettings::bPrewarmFunctionTables ? 1 : 0);
+
 
 
 	// Start Namespace 'InSDKUtils'
@@ -3044,8 +3174,37 @@ namespace BasicFilesImpleUtils
 	UObject* GetObjectByIndex(int32 Index);
 
 	UFunction* FindFunctionByFName(const FName* Name);
+
+	/*
+	* Helper functions for UClass::GetFunction, every class gets a table of its functions keyed by name when it is first searched.
+	* 
+	* FindFunctionInClass only searches the 'Children' of 'Class' itself. PrewarmFunctionTables builds the tables of all classes in
+	* GObjects on a background thread, it is called on GObjects-initialization if SDK_PREWARM_FUNCTION_TABLES is set.
+	*/
+	UFunction* FindFunctionInClass(const class UStruct* Class, const std::string& FuncName);
+	void PrewarmFunctionTables();
+}
+)";
+
+	if constexpr (CppSettings::bAddObjectLookupIndex)
+	{
+		BasicHpp << R"(
+namespace BasicFilesImpleUtils
+{
+	/*
+	* Lowest-index object named 'Name' for which 'Filter' returns true.
+	* 
+	* Looked up in an index of GObjects keyed by object name, which is built on the first call. Objects appended to GObjects since the
+	* previous call are indexed before every lookup. Objects placed into slots freed by garbage collection are only found after calling
+	* RebuildObjectLookupIndex().
+	*/
+	UObject* FindObjectByName(const std::string& Name, const std::function<bool(UObject*)>& Filter);
+
+	/* Drops the index, the next lookup indexes all objects again. Useful after a level change. */
+	void RebuildObjectLookupIndex();
 }
 )";
+	}
 
 	BasicCpp << R"(
 class UClass* BasicFilesImpleUtils::FindClassByName(const std::string& Name)
@@ -3078,6 +3237,172 @@ class UObject* BasicFilesImpleUtils::GetObjectByIndex(int32 Index)
 	return UObject::GObjects->GetByIndex(Index);
 }
 
+)";
+
+	BasicCpp << R"(
+namespace BasicFilesImpleUtils
+{
+	struct FClassFunctionTable
+	{
+		/* FName of the class represented as a uint64, a different class might be loaded at the same address later */
+		uint64 ClassFName;
+
+		/* First function of each name in the 'Children' list of the class */
+		std::unordered_map<std::string, UFunction*> FunctionsByName;
+	};
+
+	static std::shared_mutex FunctionTablesLock;
+	static std::unordered_map<const UStruct*, FClassFunctionTable> FunctionTables;
+
+	static uint64 GetStructFNameAsUInt64(const UStruct* Struct)
+	{
+		return *reinterpret_cast<const uint64*>(&Struct->Name);
+	}
+
+	/* Caller holds FunctionTablesLock exclusively */
+	static FClassFunctionTable& BuildFunctionTable(const UStruct* Class)
+	{
+		FClassFunctionTable& Table = FunctionTables[Class];
+
+		Table.ClassFName = GetStructFNameAsUInt64(Class);
+		Table.FunctionsByName.clear();
+
+		for (UField* Field = Class->Children; Field; Field = Field->Next)
+		{
+			if (Field->HasTypeFlag(EClassCastFlags::Function))
+				Table.FunctionsByName.emplace(Field->GetName(), static_cast<UFunction*>(Field));
+		}
+
+		return Table;
+	}
+
+	static UFunction* FindFunctionInTable(const FClassFunctionTable& Table, const std::string& FuncName)
+	{
+		auto It = Table.FunctionsByName.find(FuncName);
+
+		return It != Table.FunctionsByName.end() ? It->second : nullptr;
+	}
+}
+
+UFunction* BasicFilesImpleUtils::FindFunctionInClass(const UStruct* Class, const std::string& FuncName)
+{
+	const uint64 ClassFName = GetStructFNameAsUInt64(Class);
+
+	{
+		std::shared_lock Lock(FunctionTablesLock);
+
+		auto It = FunctionTables.find(Class);
+
+		if (It != FunctionTables.end() && It->second.ClassFName == ClassFName)
+			return FindFunctionInTable(It->second, FuncName);
+	}
+
+	std::unique_lock Lock(FunctionTablesLock);
+
+	return FindFunctionInTable(BuildFunctionTable(Class), FuncName);
+}
+
+void BasicFilesImpleUtils::PrewarmFunctionTables()
+{
+	std::thread([]() -> void
+	{
+		for (int i = 0; i < UObject::GObjects->Num(); ++i)
+		{
+			UObject* Object = UObject::GObjects->GetByIndex(i);
+
+			if (!Object || !Object->HasTypeFlag(EClassCastFlags::Class))
+				continue;
+
+			const UStruct* Class = static_cast<const UStruct*>(Object);
+
+			std::unique_lock Lock(FunctionTablesLock);
+
+			auto It = FunctionTables.find(Class);
+
+			if (It == FunctionTables.end() || It->second.ClassFName != GetStructFNameAsUInt64(Class))
+				BuildFunctionTable(Class);
+		}
+	}).detach();
+}
+
+)";
+
+	if constexpr (CppSettings::bAddObjectLookupIndex)
+	{
+		BasicCpp << R"(
+namespace BasicFilesImpleUtils
+{
+	struct FObjectLookupIndex
+	{
+		std::mutex Lock;
+
+		/* Indices into GObjects, ascending, keyed by the hash of the object's name */
+		std::unordered_map<uint64, std::vector<int32>> IndicesByNameHash;
+		int32 NumIndexedObjects = 0x0;
+	};
+
+	static FObjectLookupIndex ObjectLookupIndex;
+
+	/* Indexes every object appended since the last call, caller holds ObjectLookupIndex.Lock */
+	static void UpdateObjectLookupIndex()
+	{
+		const int32 NumObjects = UObject::GObjects->Num();
+
+		for (int32 i = ObjectLookupIndex.NumIndexedObjects; i < NumObjects; ++i)
+		{
+			UObject* Object = UObject::GObjects->GetByIndex(i);
+
+			if (!Object)
+				continue;
+
+			ObjectLookupIndex.IndicesByNameHash[std::hash<std::string>{}(Object->GetName())].push_back(i);
+		}
+
+		ObjectLookupIndex.NumIndexedObjects = NumObjects;
+	}
+}
+
+UObject* BasicFilesImpleUtils::FindObjectByName(const std::string& Name, const std::function<bool(UObject*)>& Filter)
+{
+	std::scoped_lock Lock(ObjectLookupIndex.Lock);
+
+	UpdateObjectLookupIndex();
+
+	auto It = ObjectLookupIndex.IndicesByNameHash.find(std::hash<std::string>{}(Name));
+
+	if (It == ObjectLookupIndex.IndicesByNameHash.end())
+		return nullptr;
+
+	for (int32 Index : It->second)
+	{
+		UObject* Object = UObject::GObjects->GetByIndex(Index);
+
+		/* Hashes can collide and slots can be reused by a different object after garbage collection */
+		if (Object && Object->GetName() == Name && Filter(Object))
+			return Object;
+	}
+
+	return nullptr;
+}
+
+void BasicFilesImpleUtils::RebuildObjectLookupIndex()
+{
+	std::scoped_lock Lock(ObjectLookupIndex.Lock);
+
+	ObjectLookupIndex.IndicesByNameHash.clear();
+	ObjectLookupIndex.NumIndexedObjects = 0x0;
+}
+
+UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
+{
+	return static_cast<UFunction*>(FindObjectByName(Name->ToString(), [Name](UObject* Object) -> bool { return Object->Name == *Name; }));
+}
+
+)";
+	}
+	else
+	{
+		BasicCpp << R"(
 UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
 {
 	for (int i = 0; i < UObject::GObjects->Num(); ++i)
@@ -3095,6 +3420,7 @@ UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
 }
 
 )";
+	}
 
 	/* Implementation of 'UObject::StaticClass()', templated to allow for a per-class local static class-pointer */
 	BasicHpp << R"(
@@ -3380,6 +3706,12 @@ R"({
 
 	/* TUObjectArrayWrapper so InitGObjects() doesn't need to be called manually anymore */
 	// Start class 'TUObjectArrayWrapper'
+	constexpr const char* PrewarmFunctionTablesCall = R"(
+
+#if SDK_PREWARM_FUNCTION_TABLES
+		BasicFilesImpleUtils::PrewarmFunctionTables();
+#endif)";
+
 	BasicHpp << R"(
 class TUObjectArrayWrapper
 {
@@ -3402,7 +3734,7 @@ public:
 private:
 	inline void InitGObjects()
 	{
-		GObjectsAddress = reinterpret_cast<void*>(InSDKUtils::GetImageBase() + Offsets::GObjects);
+		GObjectsAddress = reinterpret_cast<void*>(InSDKUtils::GetImageBase() + Offsets::GObjects);)" << PrewarmFunctionTablesCall << R"(
 	}
 
 public:)";
@@ -3411,7 +3743,7 @@ public:)";
 	BasicHpp << R"(
 	inline void InitManually(void* GObjectsAddressParameter)
 	{
-		GObjectsAddress = GObjectsAddressParameter;
+		GObjectsAddress = GObjectsAddressParameter;)" << PrewarmFunctionTablesCall << R"(
 	}
 )"; }
 	BasicHpp << R"(
@@ -479,7 +479,7 @@ void DumpspaceGenerator::Generate()
 			DSGen::bakeEnum(Enum);
 		}
 
-		DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
+		auto GenerateClassOrStructCallback = [&](int32 Index) -> void
 		{
 			DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
 			DSGen::bakeStructOrClass(StructOrClass);
@@ -9,6 +9,11 @@
 #include "Utils.h"
 #include "Menu/Logger.h"
 #include "Unreal/NameArray.h"
+#include "Unreal/NameCache.h"
+#include "Unreal/ObjectPathCache.h"
+#include "Unreal/StructChildCache.h"
+#include "Unreal/ReflectionSnapshot.h"
+#include "OffsetFinder/OffsetCache.h"
 
 inline void InitWeakObjectPtrSettings()
 {
@@ -72,40 +77,82 @@ inline void InitSettings()
 void Generator::InitEngineCore()
 {
 	LogInfo("Initializing Engine Core...");
+
+	if (Settings::Generator::ProcessSnapshotPath && !Memory::LoadSnapshot(Settings::Generator::ProcessSnapshotPath))
+	{
+		LogError("Could not load the process snapshot, aborting!");
+		return;
+	}
 	
-	/* manual override */
-	//ObjectArray::Init(/*GObjects*/, /*ChunkSize*/, /*bIsChunked*/);
-	//FName::Init(/*FName::AppendString*/);
-	//FName::Init(/*FName::ToString, FName::EOffsetOverrideType::ToString*/);
-	//FName::Init(/*GNames, FName::EOffsetOverrideType::GNames, true/false*/);
-	//Off::InSDK::ProcessEvent::InitPE(/*PEIndex*/);
+	if (!Settings::Generator::bUseOffsetCache || !OffsetCache::TryLoad())
+	{
+		/* manual override */
+		//ObjectArray::Init(/*GObjects*/, /*ChunkSize*/, /*bIsChunked*/);
+		//FName::Init(/*FName::AppendString*/);
+		//FName::Init(/*FName::ToString, FName::EOffsetOverrideType::ToString*/);
+		//FName::Init(/*GNames, FName::EOffsetOverrideType::GNames, true/false*/);
+		//Off::InSDK::ProcessEvent::InitPE(/*PEIndex*/);
 
-	/* Back4Blood (requires manual GNames override) */
-	//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x8375); });
+		/* Back4Blood (requires manual GNames override) */
+		//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x8375); });
 
-	/* Multiversus [Unsupported, weird GObjects-struct] */
-	//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x1B5DEAFD6B4068C); });
+		/* Multiversus [Unsupported, weird GObjects-struct] */
+		//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x1B5DEAFD6B4068C); });
 
-	ObjectArray::Init();
-//    FName::Init((int32)0x0CB41B80, FName::EOffsetOverrideType::GNames, true, "UAGame"); // ArenaBreakout
-    //    FName::Init((int32)0x05E4AD40, FName::EOffsetOverrideType::GNames, true, "ShooterGame"); // ARK Revamp
-    FName::Init((int32)0x420fc48, FName::EOffsetOverrideType::GNames, false /* Not FNamePool */, "ShooterGame"); // ARK 2.0
-//    FName::Init();
-	Off::Init();
-	PropertySizes::Init();
-	Off::InSDK::ProcessEvent::InitPE(70); //Must be at this position, relies on offsets initialized in Off::Init()
+		ObjectArray::Init();
+	//    FName::Init((int32)0x0CB41B80, FName::EOffsetOverrideType::GNames, true, "UAGame"); // ArenaBreakout
+		//    FName::Init((int32)0x05E4AD40, FName::EOffsetOverrideType::GNames, true, "ShooterGame"); // ARK Revamp
+		FName::Init((int32)0x420fc48, FName::EOffsetOverrideType::GNames, false /* Not FNamePool */, "ShooterGame"); // ARK 2.0
+	//    FName::Init();
+		Off::Init();
 
-	Off::InSDK::World::InitGWorld(); //Must be at this position, relies on offsets initialized in Off::Init()
+		/* Object names can be decoded from here on, every following FindObject call probes the name index */
+		ObjectArray::EnableNameIndex();
+
+		PropertySizes::Init();
+		Off::InSDK::ProcessEvent::InitPE(70); //Must be at this position, relies on offsets initialized in Off::Init()
+
+		Off::InSDK::World::InitGWorld(); //Must be at this position, relies on offsets initialized in Off::Init()
+
+		/* Calls ProcessEvent, which only exists in the live process */
+		if (Memory::IsLive())
+			Off::InSDK::Text::InitTextOffsets(); //Must be at this position, relies on offsets initialized in Off::InitPE()
+
+		/* Text offsets are missing when running from a snapshot, only cache complete results */
+		if (Settings::Generator::bUseOffsetCache && Memory::IsLive())
+			OffsetCache::Save();
+	}
 
-	Off::InSDK::Text::InitTextOffsets(); //Must be at this position, relies on offsets initialized in Off::InitPE()
+	/* Offsets loaded from the cache skip the block above */
+	ObjectArray::EnableNameIndex();
 
 	InitSettings();
+
+	/* Offsets and settings are final from here on, names can be decoded once and cached */
+	NameCache::Enable();
+	ObjectPathCache::Enable();
+
+	/* bUseFProperty is final as well, child lists copied from here on stay valid for the whole dump */
+	StructChildCache::Enable();
+
+	const MemoryReaderStats ReaderStats = Memory::GetReader().GetStats();
+	LogInfo("Readability checks: %llu cache hits, %llu misses, %llu cache rebuilds, %llu single-region inserts", ReaderStats.CacheHits, ReaderStats.CacheMisses, ReaderStats.CacheRebuilds, ReaderStats.RegionInserts);
+
+	if constexpr (Settings::Debug::bWriteProcessSnapshot)
+	{
+		if (Memory::IsLive())
+			Memory::WriteSnapshot(fs::path(Settings::Generator::SDKGenerationPath) / "Documents" / "ProcessSnapshot.d7snap");
+	}
+
 	LogSuccess("Engine Core initialized successfully");
 }
 
 void Generator::InitInternal()
 {
 	LogInfo("Initializing Internal Generator...");
+
+	// Walk GObjects once, all managers below read from the snapshot instead of the live objects
+	ReflectionSnapshot::Init();
 	
 	// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
 	PackageManager::Init();
@@ -122,6 +169,10 @@ void Generator::InitInternal()
 	// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
 	PackageManager::PostInit();
 	
+	NameCache::LogStats();
+	ObjectPathCache::LogStats();
+	StructChildCache::LogStats();
+
 	LogSuccess("Internal Generator initialized successfully");
 }
 
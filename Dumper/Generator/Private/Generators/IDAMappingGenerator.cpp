@@ -1,12 +1,49 @@
 
 #include <fstream>
+#include <algorithm>
 
 #include "Generators/IDAMappingGenerator.h"
+#include "Unreal/ReflectionSnapshot.h"
 
 
-std::string IDAMappingGenerator::MangleFunctionName(const std::string& ClassName, const std::string& FunctionName)
+void IDAMappingGenerator::AppendMangledFunctionName(std::string& Out, std::string_view ClassName, std::string_view FunctionName)
 {
-	return "_ZN" + std::to_string(ClassName.length()) + ClassName + std::to_string(FunctionName.length() + 4) + "exec" + FunctionName + "Ev";
+	/* _ZN<Len><ClassName><Len + 4>exec<FunctionName>Ev */
+	Out += "_ZN";
+	Out += std::to_string(ClassName.length());
+	Out += ClassName;
+	Out += std::to_string(FunctionName.length() + 4);
+	Out += "exec";
+	Out += FunctionName;
+	Out += "Ev";
+}
+
+void* IDAMappingGenerator::GetClassVft(UEClass Class)
+{
+	auto [It, bInserted] = ClassVftCache.try_emplace(Class.GetIndex(), nullptr);
+
+	if (bInserted)
+	{
+		if (UEObject DefaultObject = Class.GetDefaultObject())
+			It->second = DefaultObject.GetVft();
+	}
+
+	return It->second;
+}
+
+void IDAMappingGenerator::AddRecord(uint32 Offset, size_t NameStart)
+{
+	Records.push_back({ Offset, static_cast<uint32>(NameStart), static_cast<uint16>(NameBlob.length() - NameStart) });
+}
+
+void IDAMappingGenerator::SortAndRemoveDuplicates()
+{
+	/* Stable, so the first record added for an offset is the one that's kept */
+	std::stable_sort(Records.begin(), Records.end(), [](const IdmapRecord& Left, const IdmapRecord& Right) { return Left.Offset < Right.Offset; });
+
+	auto NewEnd = std::unique(Records.begin(), Records.end(), [](const IdmapRecord& Left, const IdmapRecord& Right) { return Left.Offset == Right.Offset; });
+
+	Records.erase(NewEnd, Records.end());
 }
 
 void IDAMappingGenerator::WriteReadMe(StreamType& ReadMe)
@@ -35,53 +72,116 @@ struct Identifier
     uint16 NameLength;
     const char Name[NameLength]; // Not NULL-terminated
 };
+
+Identifiers are sorted by Offset, every Offset occurs only once.
+
+
+Optional binary index ('.idmapidx', Settings::IDAMappingGenerator::bGenerateBinaryIndex):
+
+struct Header
+{
+    char Magic[4]; // "D7IX"
+    uint32 Version; // 1
+    uint32 NumEntries;
+    uint32 StringBlobSize;
+};
+
+struct Entry
+{
+    uint32 Offset; // Relative to Imagebase, sorted
+    uint32 NameOffset; // Relative to the start of StringBlob
+    uint32 NameLength;
+};
+
+Header, followed by Entry[NumEntries], followed by char StringBlob[StringBlobSize] (names are not NULL-terminated).
+
+Dumper/Utils/Scripts/import_idmap.py accepts both formats.
 )";
 }
 
-void IDAMappingGenerator::GenerateVTableName(StreamType& IdmapFile, UEObject DefaultObject)
+void IDAMappingGenerator::GenerateVTableName(UEObject DefaultObject)
 {
 	UEClass Class = DefaultObject.GetClass();
 	UEClass Super = Class.GetSuper().Cast<UEClass>();
 
-	if (Super && DefaultObject.GetVft() == Super.GetDefaultObject().GetVft())
+	void* Vft = DefaultObject.GetVft();
+
+	if (Super && Vft == GetClassVft(Super))
 		return;
 
-	std::string Name = Class.GetCppName() + "_VFT";
+	const size_t NameStart = NameBlob.length();
 
-	uint32 Offset = static_cast<uint32>(GetOffset(DefaultObject.GetVft()));
-	uint16 NameLen = static_cast<uint16>(Name.length());
+	NameBlob += Class.GetCppName();
+	NameBlob += "_VFT";
 
-	WriteToStream(IdmapFile, Offset);
-	WriteToStream(IdmapFile, NameLen);
-	WriteToStream(IdmapFile, Name.c_str(), NameLen);
+	AddRecord(static_cast<uint32>(GetOffset(Vft)), NameStart);
 }
 
-void IDAMappingGenerator::GenerateClassFunctions(StreamType& IdmapFile, UEClass Class)
+void IDAMappingGenerator::GenerateClassFunctions(UEClass Class)
 {
-	static std::unordered_map<uint32, std::string> Funcs;
+	std::string ClassName;
 
-	for (UEFunction Func : Class.GetFunctions())
+	for (UEFunction Func : Class.IterateFunctions())
 	{
 		if (!Func.HasFlags(EFunctionFlags::Native))
 			continue;
 
-		std::string MangledName = MangleFunctionName(Class.GetCppName(), Func.GetValidName());
+		if (ClassName.empty())
+			ClassName = Class.GetCppName();
 
-		uint32 Offset = static_cast<uint32>(GetOffset(Func.GetExecFunction()));
-		uint16 NameLen = static_cast<uint16>(MangledName.length());
+		const size_t NameStart = NameBlob.length();
 
-		auto [It, bInseted] = Funcs.emplace(Offset, Func.GetFullName());
+		AppendMangledFunctionName(NameBlob, ClassName, Func.GetValidName());
 
-		if (!bInseted)
-		{
-			//std::cout << "Collision: \nOld: " << It->second << "\nNew: " << Func.GetFullName() << "\n" << std::endl;
-			continue;
-		}
+		/* Several functions can share one exec-function, duplicates are removed once all records were collected */
+		AddRecord(static_cast<uint32>(GetOffset(Func.GetExecFunction())), NameStart);
+	}
+}
+
+void IDAMappingGenerator::WriteIdmap(StreamType& IdmapFile)
+{
+	size_t FileSize = 0x0;
+
+	for (const IdmapRecord& Record : Records)
+		FileSize += sizeof(uint32) + sizeof(uint16) + Record.NameLength;
 
-		WriteToStream(IdmapFile, Offset);
-		WriteToStream(IdmapFile, NameLen);
-		WriteToStream(IdmapFile, MangledName.c_str(), NameLen);
+	std::string Output;
+	Output.reserve(FileSize);
+
+	for (const IdmapRecord& Record : Records)
+	{
+		Output.append(reinterpret_cast<const char*>(&Record.Offset), sizeof(Record.Offset));
+		Output.append(reinterpret_cast<const char*>(&Record.NameLength), sizeof(Record.NameLength));
+		Output.append(NameBlob, Record.NameOffset, Record.NameLength);
 	}
+
+	IdmapFile.write(Output.data(), Output.size());
+}
+
+void IDAMappingGenerator::WriteBinaryIndex(StreamType& IndexFile)
+{
+	std::string StringBlob;
+	StringBlob.reserve(NameBlob.size());
+
+	std::vector<IdmapIndexEntry> Entries;
+	Entries.reserve(Records.size());
+
+	/* Only names of records that survived deduplication end up in the blob, in the same order as the entries */
+	for (const IdmapRecord& Record : Records)
+	{
+		Entries.push_back({ Record.Offset, static_cast<uint32>(StringBlob.size()), Record.NameLength });
+		StringBlob.append(NameBlob, Record.NameOffset, Record.NameLength);
+	}
+
+	IdmapIndexHeader Header;
+	memcpy(Header.Magic, IdmapIndexMagic, sizeof(Header.Magic));
+	Header.Version = IdmapIndexVersion;
+	Header.NumEntries = static_cast<uint32>(Entries.size());
+	Header.StringBlobSize = static_cast<uint32>(StringBlob.size());
+
+	WriteToStream(IndexFile, Header);
+	WriteToStream(IndexFile, Entries.data(), static_cast<int32>(Entries.size() * sizeof(IdmapIndexEntry)));
+	WriteToStream(IndexFile, StringBlob.data(), static_cast<int32>(StringBlob.size()));
 }
 
 void IDAMappingGenerator::Generate()
@@ -90,26 +190,48 @@ void IDAMappingGenerator::Generate()
 
 	FileNameHelper::MakeValidFileName(IdaMappingFileName);
 
-	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
-	std::ofstream IdmapFile(MainFolder / IdaMappingFileName, std::ios::binary);
-
 	/* Create a ReadMe to describe what '.idmap' is, and how to use it */
-	std::ofstream ReadMe(MainFolder / "ReadMe.txt");
+	StreamType ReadMe(MainFolder / "ReadMe.txt");
 
 	/* Write description of the file format, as well as a link to the IDA-Plugin */
 	WriteReadMe(ReadMe);
 
-	for (UEObject Obj : ObjectArray())
+	Records.clear();
+	NameBlob.clear();
+	ClassVftCache.clear();
+
+	const ReflectionSnapshot::ObjectTable& Objects = ReflectionSnapshot::GetObjects();
+
+	for (int32 ObjIndex = 0; ObjIndex < Objects.Num(); ObjIndex++)
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+		if (!Objects.Address[ObjIndex])
+			continue;
+
+		if (Objects.Flags[ObjIndex] & EObjectFlags::ClassDefaultObject)
 		{
-			/* Gets the VTable offset from the default object and writes the ClassName + "_VFT" postfix to the file */
-			GenerateVTableName(IdmapFile, Obj);
+			/* Gets the VTable offset from the default object and adds the ClassName + "_VFT" postfix */
+			GenerateVTableName(ReflectionSnapshot::GetObject(ObjIndex));
 		}
-		else if (Obj.IsA(EClassCastFlags::Class))
+		else if (ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Class))
 		{
-			/* Iterates all of the functions of the class and them to the stream with an "exec" prefix in front of the function name */
-			GenerateClassFunctions(IdmapFile, Obj.Cast<UEClass>());
+			/* Iterates all of the functions of the class and adds them with an "exec" prefix in front of the function name */
+			GenerateClassFunctions(ReflectionSnapshot::GetObject<UEClass>(ObjIndex));
 		}
 	}
-}
\ No newline at end of file
+
+	SortAndRemoveDuplicates();
+
+	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
+	StreamType IdmapFile(MainFolder / IdaMappingFileName, std::ios::binary);
+	WriteIdmap(IdmapFile);
+
+	if constexpr (Settings::IDAMappingGenerator::bGenerateBinaryIndex)
+	{
+		StreamType IndexFile(MainFolder / (IdaMappingFileName + "idx"), std::ios::binary);
+		WriteBinaryIndex(IndexFile);
+	}
+
+	Records.clear();
+	NameBlob.clear();
+	ClassVftCache.clear();
+}
@@ -4,6 +4,7 @@
 
 #include "Generators/MappingGenerator.h"
 #include "Managers/PackageManager.h"
+#include "Unreal/ReflectionSnapshot.h"
 #include "Utils/Compression/zstd.h"
 
 #include "Settings.h"
@@ -133,32 +134,101 @@ EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
     return EMappingsTypeFlags::Unknown;
 }
 
-int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
+void MappingGenerator::ResetNameTable()
+{
+    NameCounter = 0x0;
+
+    UniqueNames.clear();
+    NameIndexByString.clear();
+    NameIndexByCompIdx.clear();
+    NameIndexByNumberedName.clear();
+}
+
+int32 MappingGenerator::AddNameToData(std::string_view Name)
 {
     if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
     {
-        static std::unordered_map<std::string, int32> NameMap;
-        
-        auto [It, bInserted] = NameMap.insert({ Name, NameCounter });
+        auto It = NameIndexByString.find(Name);
 
-        /* The name didn't occure yet, write it to the NameTable */
-        if (bInserted)
-        {
-            WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-            NameTable.write(Name.c_str(), Name.length());
-            return NameCounter++;
-        }
+        if (It != NameIndexByString.end())
+            return It->second;
+    }
+
+    /* The name didn't occure yet, add it to the NameTable */
+    const int32 NewIndex = static_cast<int32>(NameCounter++);
+    const std::string& StoredName = UniqueNames.emplace_back(Name);
 
-        return It->second;
+    if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
+        NameIndexByString.emplace(StoredName, NewIndex);
+
+    return NewIndex;
+}
+
+int32 MappingGenerator::AddNameToData(FName Name)
+{
+    if constexpr (!Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
+        return AddNameToData(Name.ToStringView());
+
+    /* Case-preserving names are decoded through their display-index, which isn't part of the CompIdx/Number key */
+    if (Settings::Internal::bUseCasePreservingName)
+        return AddNameToData(Name.ToStringView());
+
+    const int32 CompIdx = Name.GetCompIdx();
+    const uint32 Number = Name.GetNumber();
+
+    /* Numbered names are rare, a map is good enough for them */
+    if (Number != 0x0 || CompIdx < 0)
+    {
+        const uint64 Key = (static_cast<uint64>(static_cast<uint32>(CompIdx)) << 32) | Number;
+
+        auto It = NameIndexByNumberedName.find(Key);
+
+        if (It != NameIndexByNumberedName.end())
+            return It->second;
+
+        const int32 NewIndex = AddNameToData(Name.ToStringView());
+        NameIndexByNumberedName.emplace(Key, NewIndex);
+
+        return NewIndex;
     }
 
-    WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-    NameTable.write(Name.c_str(), Name.length());
+    const size_t PageIdx = static_cast<size_t>(CompIdx) >> NameIndexPageBits;
+
+    if (PageIdx >= NameIndexByCompIdx.size())
+        NameIndexByCompIdx.resize(PageIdx + 1);
 
-    return NameCounter++;
+    std::unique_ptr<uint32[]>& Page = NameIndexByCompIdx[PageIdx];
+
+    if (!Page)
+        Page = std::make_unique<uint32[]>(NameIndexPageSize);
+
+    uint32& IndexPlusOne = Page[CompIdx & (NameIndexPageSize - 1)];
+
+    if (IndexPlusOne == 0x0)
+        IndexPlusOne = static_cast<uint32>(AddNameToData(Name.ToStringView())) + 1;
+
+    return static_cast<int32>(IndexPlusOne - 1);
 }
 
-void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::WriteNameTable(UsmapPayload& Payload)
+{
+    size_t NameTableSize = 0x0;
+
+    for (const std::string& Name : UniqueNames)
+        NameTableSize += sizeof(uint16) + Name.length();
+
+    Payload.NameData.reserve(NameTableSize);
+
+    for (const std::string& Name : UniqueNames)
+    {
+        WriteToStream(Payload.NameData, static_cast<uint16>(Name.length()));
+        Payload.NameData.append(Name);
+    }
+
+    Payload.NumNames = static_cast<uint32>(NameCounter);
+}
+
+void MappingGenerator::GeneratePropertyType(UEProperty Property, std::string& Data)
 {
     if (!Property)
     {
@@ -179,42 +249,42 @@ void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstre
 
     if (MappingType == EMappingsTypeFlags::EnumProperty)
     {
-        GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Data, NameTable);
+        GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Data);
 
-        const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEEnumProperty>().GetEnum().GetName());
+        const int32 EnumNameIdx = AddObjectNameToData(Property.Cast<UEEnumProperty>().GetEnum());
         WriteToStream(Data, EnumNameIdx);
     }
     else if (bIsFakeEnumProperty)
     {
-        const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEByteProperty>().GetEnum().GetName());
+        const int32 EnumNameIdx = AddObjectNameToData(Property.Cast<UEByteProperty>().GetEnum());
         WriteToStream(Data, EnumNameIdx);
     }
     else if (MappingType == EMappingsTypeFlags::StructProperty)
     {
-        const int32 StructNameIdx = AddNameToData(NameTable, Property.Cast<UEStructProperty>().GetUnderlayingStruct().GetName());
+        const int32 StructNameIdx = AddObjectNameToData(Property.Cast<UEStructProperty>().GetUnderlayingStruct());
         WriteToStream(Data, StructNameIdx);
     }
     else if (MappingType == EMappingsTypeFlags::SetProperty)
     {
-        GeneratePropertyType(Property.Cast<UESetProperty>().GetElementProperty(), Data, NameTable);
+        GeneratePropertyType(Property.Cast<UESetProperty>().GetElementProperty(), Data);
     }
     else if (MappingType == EMappingsTypeFlags::ArrayProperty)
     {
-        GeneratePropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty(), Data, NameTable);
+        GeneratePropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty(), Data);
     }
     else if (MappingType == EMappingsTypeFlags::OptionalProperty)
     {
-        GeneratePropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty(), Data, NameTable);
+        GeneratePropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty(), Data);
     }
     else if (MappingType == EMappingsTypeFlags::MapProperty)
     {
         UEMapProperty AsMapProperty = Property.Cast<UEMapProperty>();
-        GeneratePropertyType(AsMapProperty.GetKeyProperty(), Data, NameTable);
-        GeneratePropertyType(AsMapProperty.GetValueProperty(), Data, NameTable);
+        GeneratePropertyType(AsMapProperty.GetKeyProperty(), Data);
+        GeneratePropertyType(AsMapProperty.GetValueProperty(), Data);
     }
 }
 
-void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index)
+void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::string& Data, int32& Index)
 {
     if (!Property.IsUnrealProperty())
     {
@@ -225,20 +295,20 @@ void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std
     WriteToStream(Data, static_cast<uint16>(Index));
     WriteToStream(Data, static_cast<uint8>(Property.GetArrayDim()));
 
-    const int32 MemberNameIdx = AddNameToData(NameTable, Property.GetUnrealProperty().GetName());
+    const int32 MemberNameIdx = AddObjectNameToData(Property.GetUnrealProperty());
     WriteToStream(Data, MemberNameIdx);
 
-    GeneratePropertyType(Property.GetUnrealProperty(), Data, NameTable);
+    GeneratePropertyType(Property.GetUnrealProperty(), Data);
 
     Index += Property.GetArrayDim();
 }
 
-void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::string& Data)
 {
     if (!Struct.IsValid())
         return;
 
-    const int32 StructNameIndex = AddNameToData(NameTable, Struct.GetRawName());
+    const int32 StructNameIndex = Struct.IsUnrealStruct() ? AddObjectNameToData(Struct.GetUnrealStruct()) : AddNameToData(Struct.GetRawName());
     WriteToStream(Data, StructNameIndex);
 
     StructWrapper Super = Struct.GetSuper();
@@ -246,7 +316,7 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
     if (Super.IsValid())
     {
         /* Most likely adds a duplicate to the name-table. Find a better solution later! */
-        const int32 SuperNameIndex = AddNameToData(NameTable, Super.GetRawName());
+        const int32 SuperNameIndex = Super.IsUnrealStruct() ? AddObjectNameToData(Super.GetUnrealStruct()) : AddNameToData(Super.GetRawName());
         WriteToStream(Data, SuperNameIndex);
     }
     else
@@ -281,33 +351,35 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
         if (ExcludeEditorOnlyProps && Member.HasPropertyFlags(EPropertyFlags::EditorOnly))
             continue;
 
-        GeneratePropertyInfo(Member, Data, NameTable, IndexIncrementedByFunction);
+        GeneratePropertyInfo(Member, Data, IndexIncrementedByFunction);
     }
 }
 
-void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::string& Data)
 {
-    const int32 EnumNameIndex = AddNameToData(NameTable, Enum.GetRawName());
+    const int32 EnumNameIndex = AddObjectNameToData(Enum.GetUnrealEnum());
     WriteToStream(Data, EnumNameIndex);
 
     WriteToStream(Data, static_cast<uint16>(Enum.GetNumMembers()));
 
     for (EnumCollisionInfo Member : Enum.GetMembers())
     {
-        const int32 EnumMemberNameIdx = AddNameToData(NameTable, Member.GetUniqueName());
+        const int32 EnumMemberNameIdx = AddNameToData(Member.GetUniqueName());
         WriteToStream(Data, EnumMemberNameIdx);
     }
 }
 
 
-std::stringstream MappingGenerator::GenerateFileData()
+MappingGenerator::UsmapPayload MappingGenerator::GenerateFileData()
 {
-    std::stringstream NameData;
-    std::stringstream StructData;
-    std::stringstream EnumData;
+    UsmapPayload Payload;
 
-    uint32 NumEnums = 0x0;
-    uint32 NumStructsAndClasse = 0x0;
+    /* Rough estimate, avoids most of the reallocations while the buffers grow */
+    if (ReflectionSnapshot::IsInitialized())
+    {
+        Payload.EnumData.reserve(ReflectionSnapshot::GetEnums().Num() * 0x40);
+        Payload.StructData.reserve((ReflectionSnapshot::GetStructs().Num() * 0xC) + (ReflectionSnapshot::GetProperties().Num() * 0xC));
+    }
 
     /* Handle all Enums first */
     for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
@@ -321,8 +393,8 @@ std::stringstream MappingGenerator::GenerateFileData()
 
         for (int32 EnumIdx : Package.GetEnums())
         {
-            GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), EnumData, NameData);
-            NumEnums++;
+            GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), Payload.EnumData);
+            Payload.NumEnums++;
         }
     }
     
@@ -336,10 +408,10 @@ std::stringstream MappingGenerator::GenerateFileData()
         if (!Package.HasClasses() && !Package.HasStructs())
             continue;
 
-        DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
+        auto GenerateStructCallback = [&](int32 Index) -> void
         {
-            GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructData, NameData);
-            NumStructsAndClasse++;
+            GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), Payload.StructData);
+            Payload.NumStructs++;
         };
 
         if (Package.HasStructs())
@@ -355,35 +427,98 @@ std::stringstream MappingGenerator::GenerateFileData()
         }
     }
 
-    /* Combine all of the stringstreams into one Data block representing the entire payload of the file */
-    std::stringstream ReturnBuffer;
-
-    /* Write Name-count and names */
-    WriteToStream(ReturnBuffer, static_cast<uint32>(NameCounter));
-    WriteToStream(ReturnBuffer, NameData);
+    /* All names are known now, write them in one go */
+    WriteNameTable(Payload);
 
     if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
-        LogInfo("MappingGeneration: NameCounter = 0x%X (Dec: %u)\n", static_cast<uint32>(NameCounter), static_cast<uint32>(NameCounter));
+    {
+        LogInfo("MappingGeneration: NameCounter = 0x%X (Dec: %u)\n", Payload.NumNames, Payload.NumNames);
+        LogInfo("MappingGeneration: NumEnums = 0x%X (Dec: %u)\n", Payload.NumEnums, Payload.NumEnums);
+        LogInfo("MappingGeneration: NumStructsAndClasse = 0x%X (Dec: %u)\n\n", Payload.NumStructs, Payload.NumStructs);
+    }
 
-    /* Write Enum-count and enums */
-    WriteToStream(ReturnBuffer, static_cast<uint32>(NumEnums));
-    WriteToStream(ReturnBuffer, EnumData);
+    return Payload;
+}
 
-    if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
-        LogInfo("MappingGeneration: NumEnums = 0x%X (Dec: %u)\n", static_cast<uint32>(NumEnums), static_cast<uint32>(NumEnums));
 
-    /* Write Struct-count and enums */
-    WriteToStream(ReturnBuffer, static_cast<uint32>(NumStructsAndClasse));
-    WriteToStream(ReturnBuffer, StructData);
+uint64 MappingGenerator::WritePayloadUncompressed(StreamType& InUsmap, const UsmapPayload& Payload)
+{
+    WriteToStream(InUsmap, Payload.NumNames);
+    InUsmap.write(Payload.NameData.data(), Payload.NameData.size());
 
-    if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
-        LogInfo("MappingGeneration: NumStructsAndClasse = 0x%X (Dec: %u)\n\n", static_cast<uint32>(NumStructsAndClasse), static_cast<uint32>(NumStructsAndClasse));
+    WriteToStream(InUsmap, Payload.NumEnums);
+    InUsmap.write(Payload.EnumData.data(), Payload.EnumData.size());
+
+    WriteToStream(InUsmap, Payload.NumStructs);
+    InUsmap.write(Payload.StructData.data(), Payload.StructData.size());
 
-    return ReturnBuffer;
+    return Payload.GetSize();
 }
 
+uint64 MappingGenerator::WritePayloadZStandard(StreamType& InUsmap, const UsmapPayload& Payload)
+{
+    ZSTD_CCtx* Context = ZSTD_createCCtx();
+
+    if (!Context)
+    {
+        LogError("MappingGeneration: ZSTD_createCCtx failed!\n");
+        return 0x0;
+    }
+
+    ZSTD_CCtx_setParameter(Context, ZSTD_c_compressionLevel, Settings::MappingGenerator::ZStandardCompressionLevel);
+    ZSTD_CCtx_setPledgedSrcSize(Context, Payload.GetSize());
+
+    /* Fails if zstd was built without ZSTD_MULTITHREAD, compression then just stays on this thread */
+    if constexpr (Settings::MappingGenerator::NumCompressionWorkers > 0)
+    {
+        const size_t Result = ZSTD_CCtx_setParameter(Context, ZSTD_c_nbWorkers, Settings::MappingGenerator::NumCompressionWorkers);
+
+        if (ZSTD_isError(Result))
+            LogError("MappingGeneration: Multithreaded compression unavailable (%s)\n", ZSTD_getErrorName(Result));
+    }
+
+    std::string OutBuffer(ZSTD_CStreamOutSize(), '\0');
+    uint64 CompressedSize = 0x0;
+
+    /* Returns false if compression failed */
+    auto CompressAndWrite = [&](const void* Data, size_t Size, ZSTD_EndDirective Mode) -> bool
+    {
+        ZSTD_inBuffer Input = { Data, Size, 0x0 };
+
+        while (true)
+        {
+            ZSTD_outBuffer Output = { OutBuffer.data(), OutBuffer.size(), 0x0 };
+
+            const size_t Remaining = ZSTD_compressStream2(Context, &Output, &Input, Mode);
+
+            if (ZSTD_isError(Remaining))
+            {
+                LogError("MappingGeneration: ZSTD_compressStream2 failed (%s)\n", ZSTD_getErrorName(Remaining));
+                return false;
+            }
+
+            InUsmap.write(OutBuffer.data(), Output.pos);
+            CompressedSize += Output.pos;
+
+            /* ZSTD_e_continue is done when all input was consumed, ZSTD_e_end when the frame was completely flushed */
+            if (Mode == ZSTD_e_end ? Remaining == 0x0 : Input.pos == Input.size)
+                return true;
+        }
+    };
+
+    const bool bSucceeded = CompressAndWrite(&Payload.NumNames, sizeof(Payload.NumNames), ZSTD_e_continue)
+        && CompressAndWrite(Payload.NameData.data(), Payload.NameData.size(), ZSTD_e_continue)
+        && CompressAndWrite(&Payload.NumEnums, sizeof(Payload.NumEnums), ZSTD_e_continue)
+        && CompressAndWrite(Payload.EnumData.data(), Payload.EnumData.size(), ZSTD_e_continue)
+        && CompressAndWrite(&Payload.NumStructs, sizeof(Payload.NumStructs), ZSTD_e_continue)
+        && CompressAndWrite(Payload.StructData.data(), Payload.StructData.size(), ZSTD_e_end);
+
+    ZSTD_freeCCtx(Context);
+
+    return bSucceeded ? CompressedSize : 0x0;
+}
 
-void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data)
+std::streampos MappingGenerator::WriteFile(StreamType& InUsmap, const UsmapPayload& Payload)
 {
     /* Write 2bytes unsigned */
     WriteToStream(InUsmap, UsmapFileMagic);
@@ -394,61 +529,86 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
     /* We're on 'LargeEnums' version, we need to write 'bool' (aka int32) bHasVersioning. (NoVersioning = false) -> no [int32 UE4Version, int32 UE5Version] and no [uint32 NetCL] */
     WriteToStream(InUsmap, static_cast<int32>(false));
 
-    const uint32 UncompressedSize = static_cast<uint32>(Data.str().length());
+    const uint32 UncompressedSize = static_cast<uint32>(Payload.GetSize());
 
     constexpr auto CompressionMethod = Settings::MappingGenerator::CompressionMethod;
 
+    const std::streampos CompressionMethodPos = InUsmap.tellp();
+
     /* Write 'CompressionMethod' to the compression byte */
     WriteToStream(InUsmap, static_cast<uint8>(CompressionMethod));
 
-    size_t CompressedSize = UncompressedSize;
-    void* CompressedBuffer = nullptr;
+    /* The compressed size is only known once the payload was written, write a placeholder and patch it afterwards */
+    const std::streampos CompressedSizePos = InUsmap.tellp();
+
+    /* Write compressed size */
+    WriteToStream(InUsmap, static_cast<uint32>(0x0));
+
+    /* Write uncompressed size */
+    WriteToStream(InUsmap, UncompressedSize);
+
+    /* Header is done, now compress the payload straight into the file */
+    uint64 CompressedSize = CompressionMethod == EUsmapCompressionMethod::ZStandard ? WritePayloadZStandard(InUsmap, Payload) : WritePayloadUncompressed(InUsmap, Payload);
 
-    switch (CompressionMethod)
+    /* Compression failed after parts of the compressed payload were already written, rewrite the header and payload as uncompressed */
+    if (CompressedSize == 0x0 && UncompressedSize != 0x0)
     {
-    case EUsmapCompressionMethod::ZStandard:
-        CompressedSize = ZSTD_compressBound(UncompressedSize);
-        CompressedBuffer = malloc(CompressedSize);
-        CompressedSize = ZSTD_compress(CompressedBuffer, CompressedSize, Data.str().data(), UncompressedSize, ZSTD_maxCLevel());
-        break;
-    default:
-        CompressedBuffer = malloc(CompressedSize);
-        memcpy(CompressedBuffer, Data.str().data(), CompressedSize);
-        break;
+        LogError("MappingGeneration: Compression failed, writing the payload uncompressed instead\n");
+
+        InUsmap.seekp(CompressionMethodPos);
+        WriteToStream(InUsmap, static_cast<uint8>(EUsmapCompressionMethod::None));
+        WriteToStream(InUsmap, static_cast<uint32>(0x0));
+        WriteToStream(InUsmap, UncompressedSize);
+
+        CompressedSize = WritePayloadUncompressed(InUsmap, Payload);
     }
 
+    const std::streampos EndPos = InUsmap.tellp();
+
     if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
     {
-        LogInfo("MappingGeneration: CompressedSize = 0x%zX (Dec: %zu)\n", CompressedSize, CompressedSize);
+        LogInfo("MappingGeneration: CompressedSize = 0x%llX (Dec: %llu)\n", CompressedSize, CompressedSize);
         LogInfo("MappingGeneration: DecompressedSize = 0x%X (Dec: %u)\n\n", UncompressedSize, UncompressedSize);
     }
 
-    /* Write compressed size */
+    InUsmap.seekp(CompressedSizePos);
     WriteToStream(InUsmap, static_cast<uint32>(CompressedSize));
+    InUsmap.seekp(EndPos);
 
-    /* Write uncompressed size */
-    WriteToStream(InUsmap, UncompressedSize);
-
-    /* Header is done, now write the payload to the file */
-    InUsmap.write(static_cast<const char*>(CompressedBuffer), static_cast<uint32>(CompressedSize));
-
-    free(CompressedBuffer);
+    return EndPos;
 }
 
 void MappingGenerator::Generate()
 {
-    NameCounter = 0x0;
+    ResetNameTable();
 
     std::string MappingsFileName = (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName + ".usmap");
 
     FileNameHelper::MakeValidFileName(MappingsFileName);
 
+    const fs::path UsmapPath = MainFolder / MappingsFileName;
+
     /* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
-    std::ofstream UsmapFile(MainFolder / MappingsFileName, std::ios::binary);
+    std::ofstream UsmapFile(UsmapPath, std::ios::binary);
+
+    if (!UsmapFile.is_open())
+    {
+        LogError("MappingGeneration: Failed to open \"%s\"\n", UsmapPath.string().c_str());
+        return;
+    }
 
     /* Generate the payload of the file, containing all of the names, enums and structs. */
-    std::stringstream FileData = GenerateFileData();
+    UsmapPayload FileData = GenerateFileData();
 
     /* Generate the header, and write both header and payload into the file. */
-    GenerateFileHeader(UsmapFile, FileData);
+    const std::streampos UsmapSize = WriteFile(UsmapFile, FileData);
+    UsmapFile.close();
+
+    /* An uncompressed fallback payload may be shorter than the compressed bytes it overwrote */
+    std::error_code Error;
+    if (UsmapSize > 0x0 && fs::file_size(UsmapPath, Error) > static_cast<uintmax_t>(UsmapSize))
+        fs::resize_file(UsmapPath, static_cast<uintmax_t>(UsmapSize), Error);
+
+    if (UsmapFile.fail() || Error)
+        LogError("MappingGeneration: Failed to write \"%s\"\n", UsmapPath.string().c_str());
 }
@@ -14,6 +14,8 @@ HashStringTable::HashStringTable(uint32 InitialBucketSize)
         CurrentBucket.Size = 0x0;
         CurrentBucket.SizeMax = InitialBucketSize;
     }
+
+    LookupIndex.resize(InitialIndexSize, IndexSlot{ 0x0, HashStringTableIndex::FromInt(HashStringTableIndex::InvalidIndex) });
 }
 
 HashStringTable::~HashStringTable()
@@ -74,6 +76,49 @@ void HashStringTable::ResizeBucket(StringBucket& Bucket)
     Bucket.SizeMax = NewBucketSizeMax;
 }
 
+template<typename CharType>
+uint64 HashStringTable::GetFullHash(const CharType* Str, int32 Length)
+{
+    constexpr uint64 WideSeed = 0x1;
+
+    return HashString64(Str, Length * sizeof(CharType), std::is_same_v<CharType, char> ? 0x0 : WideSeed);
+}
+
+void HashStringTable::InsertIntoIndex(uint64 FullHash, HashStringTableIndex Index)
+{
+    if (((NumIndexedEntries + 1) * IndexMaxLoadDenominator) > (LookupIndex.size() * IndexMaxLoadNumerator))
+        GrowIndex();
+
+    const uint64 Mask = LookupIndex.size() - 1;
+
+    for (uint64 i = FullHash & Mask; true; i = (i + 1) & Mask)
+    {
+        IndexSlot& Slot = LookupIndex[i];
+
+        if (Slot.Index == HashStringTableIndex::InvalidIndex)
+        {
+            Slot.FullHash = FullHash;
+            Slot.Index = Index;
+            NumIndexedEntries++;
+            return;
+        }
+    }
+}
+
+void HashStringTable::GrowIndex()
+{
+    std::vector<IndexSlot> OldIndex = std::move(LookupIndex);
+
+    LookupIndex.assign(OldIndex.size() * 2, IndexSlot{ 0x0, HashStringTableIndex::FromInt(HashStringTableIndex::InvalidIndex) });
+    NumIndexedEntries = 0x0;
+
+    for (const IndexSlot& Slot : OldIndex)
+    {
+        if (Slot.Index != HashStringTableIndex::InvalidIndex)
+            InsertIntoIndex(Slot.FullHash, Slot.Index);
+    }
+}
+
 template<typename CharType>
 std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharType* Str, int32 Length, uint8 Hash)
 {
@@ -108,6 +153,8 @@ std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharTy
 
     Bucket.Size += NewEmptyEntry.GetLengthBytes();
 
+    InsertIntoIndex(GetFullHash(Str, Length), ReturnIndex);
+
     return { ReturnIndex, true };
 }
 
@@ -139,22 +186,24 @@ HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, ui
 {
     constexpr bool bIsWchar = std::is_same_v<CharType, wchar_t>;
 
-    StringBucket& Bucket = Buckets[Hash];
+    const uint64 FullHash = GetFullHash(Str, Length);
+    const uint64 Mask = LookupIndex.size() - 1;
 
-    /* Try to find duplications withing 'checked' regions */
-    for (auto It = HashBucketIterator::begin(Bucket); It != HashBucketIterator::end(Bucket); ++It)
+    /* Probe until an empty slot is hit, entries are never removed so there are no tombstones */
+    for (uint64 i = FullHash & Mask; true; i = (i + 1) & Mask)
     {
-        const StringEntry& Entry = *It;
+        const IndexSlot& Slot = LookupIndex[i];
 
-        if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
-        {
-            HashStringTableIndex Idx;
-            Idx.Unused = 0x0;
-            Idx.HashIndex = Hash;
-            Idx.InBucketOffset = It.GetInBucketIndex();
+        if (Slot.Index == HashStringTableIndex::InvalidIndex)
+            break;
 
-            return Idx;
-        }
+        if (Slot.FullHash != FullHash || Slot.Index.HashIndex != Hash)
+            continue;
+
+        const StringEntry& Entry = GetStringEntry(Slot.Index);
+
+        if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
+            return Slot.Index;
     }
 
     return HashStringTableIndex::FromInt(-1);
@@ -237,6 +286,10 @@ void HashStringTable::DebugPrintStats() const
 
     LogInfo("TotalMemoryUsed: %llX\n", static_cast<unsigned long long>(TotalMemoryUsed));
     LogInfo("TotalMemoryAllocated: %llX\n", static_cast<unsigned long long>(TotalMemoryAllocated));
+    LogInfo("LookupIndex: %llu / %llu slots used (%llX bytes)\n",
+        static_cast<unsigned long long>(NumIndexedEntries),
+        static_cast<unsigned long long>(LookupIndex.size()),
+        static_cast<unsigned long long>(LookupIndex.size() * sizeof(IndexSlot)));
     
     /* %.3f limits the float/double to 3 decimal places (Matches {:.3f}) */
     LogInfo("Percentage of allocation in use: %.3f\n\n", static_cast<double>(TotalMemoryUsed) / TotalMemoryAllocated);
@@ -101,29 +101,42 @@ uint64 KeyFunctions::GetKeyForCollisionInfo([[maybe_unused]] UEStruct Super, UEF
 	return Key;
 }
 
-uint64 CollisionManager::AddNameToContainer(NameContainer& StructNames, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct, UEFunction Func)
+std::pair<CollisionManager::NameContainer&, CollisionManager::NameLookup&> CollisionManager::GetContainerAndLookup(uint64 Key)
 {
-	static auto AddCollidingName = [](const NameContainer& SearchNames, NameContainer* OutTargetNames, HashStringTableIndex NameIdx, ECollisionType CurrentType, bool bIsSuper) -> bool
-	{
-		assert(OutTargetNames && "Target container was nullptr!");
+	NameContainer& Container = NameInfos[Key];
+	NameLookup& Lookup = NameLookups[Key];
 
-		NameInfo NewInfo(NameIdx, CurrentType);
-		NewInfo.OwnType = static_cast<uint8>(CurrentType);
+	Lookup.Names = &Container;
 
-		for (auto RevIt = SearchNames.crbegin(); RevIt != SearchNames.crend(); ++RevIt)
-		{
-			const NameInfo& ExistingName = *RevIt;
+	return { Container, Lookup };
+}
 
-			if (ExistingName.Name != NameIdx)
-				continue;
+uint64 CollisionManager::PushName(NameContainer& Container, NameLookup& Lookup, const NameInfo& Info)
+{
+	const uint64 Index = Container.size();
 
-			NewInfo.InitCollisionData(ExistingName, CurrentType, bIsSuper);
-			OutTargetNames->push_back(NewInfo);
+	Container.push_back(Info);
+	Lookup.LastIndexOfName[Info.Name] = static_cast<uint32>(Index);
 
-			return true;
-		}
+	return Index;
+}
+
+uint64 CollisionManager::AddNameToContainer(NameContainer& StructNames, NameLookup& StructLookup, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct, UEFunction Func)
+{
+	/* Returns the index of the new NameInfo in OutTargetNames, or -1 if NameIdx is not contained in SearchLookup */
+	static auto AddCollidingName = [](const NameLookup& SearchLookup, NameContainer* OutTargetNames, NameLookup* OutTargetLookup, HashStringTableIndex NameIdx, ECollisionType CurrentType, bool bIsSuper) -> int64
+	{
+		assert(OutTargetNames && OutTargetLookup && "Target container was nullptr!");
+
+		const NameInfo* ExistingName = SearchLookup.Find(NameIdx);
 
-		return false;
+		if (!ExistingName)
+			return -1;
+
+		NameInfo NewInfo(NameIdx, CurrentType);
+		NewInfo.InitCollisionData(*ExistingName, CurrentType, bIsSuper);
+
+		return PushName(*OutTargetNames, *OutTargetLookup, NewInfo);
 	};
 
 	const bool bIsParameter = CurrentType == ECollisionType::ParameterName;
@@ -133,70 +146,69 @@ uint64 CollisionManager::AddNameToContainer(NameContainer& StructNames, UEStruct
 	if (bWasInserted && !bIsParameter)
 	{
 		// Create new empty NameInfo
-		StructNames.emplace_back(NameIdx, CurrentType);
-		return StructNames.size() - 1;
+		return PushName(StructNames, StructLookup, NameInfo(NameIdx, CurrentType));
 	}
 
 	NameContainer* FuncParamNames = nullptr;
+	NameLookup* FuncParamLookup = nullptr;
 
 	if (Func)
 	{
-		FuncParamNames = &NameInfos[Func.GetIndex()];
+		auto [ParamNames, ParamLookup] = GetContainerAndLookup(Func.GetIndex());
+
+		FuncParamNames = &ParamNames;
+		FuncParamLookup = &ParamLookup;
 
 		if (bWasInserted && bIsParameter)
 		{
 			// Create new empty NameInfo
-			FuncParamNames->emplace_back(NameIdx, CurrentType);
-			return FuncParamNames->size() - 1;
+			return PushName(*FuncParamNames, *FuncParamLookup, NameInfo(NameIdx, CurrentType));
 		}
 
-		if (AddCollidingName(*FuncParamNames, FuncParamNames, NameIdx, CurrentType, false))
-			return FuncParamNames->size() - 1;
+		if (const int64 Index = AddCollidingName(*FuncParamLookup, FuncParamNames, FuncParamLookup, NameIdx, CurrentType, false); Index >= 0)
+			return Index;
 
 		if (bIsStruct)
 		{
 			/* Serach ReservedNames last, just in case there was a property which also collided with a reserved name already */
-			if (AddCollidingName(ReservedNames, FuncParamNames, NameIdx, CurrentType, false))
-				return FuncParamNames->size() - 1;
+			if (const int64 Index = AddCollidingName(ReservedNamesLookup, FuncParamNames, FuncParamLookup, NameIdx, CurrentType, false); Index >= 0)
+				return Index;
 		}
 	}
 
 	NameContainer* TargetNameContainer = bIsParameter ? FuncParamNames : &StructNames;
+	NameLookup* TargetNameLookup = bIsParameter ? FuncParamLookup : &StructLookup;
 
 	/* Check all member-names from this struct and see if we're colliding with one of them */
-	if (AddCollidingName(StructNames, TargetNameContainer, NameIdx, CurrentType, false))
-		return TargetNameContainer->size() - 1;
+	if (const int64 Index = AddCollidingName(StructLookup, TargetNameContainer, TargetNameLookup, NameIdx, CurrentType, false); Index >= 0)
+		return Index;
 
 	/* This possibly duplicated name doesn't occcure in the NameList of the struct itself, so check all supers to see if we're colliding with a super's name. */
-	for (UEStruct Current = Struct.GetSuper(); Current; Current = Current.GetSuper())
+	for (const NameLookup* SuperLookup = StructLookup.Super; SuperLookup; SuperLookup = SuperLookup->Super)
 	{
-		NameContainer& SuperNames = NameInfos[Current.GetIndex()];
-
-		if (AddCollidingName(SuperNames, TargetNameContainer, NameIdx, CurrentType, true))
-			return TargetNameContainer->size() - 1;
+		if (const int64 Index = AddCollidingName(*SuperLookup, TargetNameContainer, TargetNameLookup, NameIdx, CurrentType, true); Index >= 0)
+			return Index;
 	}
 
 	if (!bIsStruct)
 	{
 		/* Serach ReservedNames last, just in case there was a predefined member of the super-class, or local variable, that collids with it. */
-		if (AddCollidingName(ClassReservedNames, TargetNameContainer, NameIdx, CurrentType, false))
-			return TargetNameContainer->size() - 1;
+		if (const int64 Index = AddCollidingName(ClassReservedNamesLookup, TargetNameContainer, TargetNameLookup, NameIdx, CurrentType, false); Index >= 0)
+			return Index;
 	}
 
 	/* Serach ReservedNames last, just in case there was a property in the struct or parent struct, which also collided with a reserved name already */
-	if (AddCollidingName(ReservedNames, TargetNameContainer, NameIdx, CurrentType, false))
-		return TargetNameContainer->size() - 1;
+	if (const int64 Index = AddCollidingName(ReservedNamesLookup, TargetNameContainer, TargetNameLookup, NameIdx, CurrentType, false); Index >= 0)
+		return Index;
 
 	/* Searching this structs' name list, the super's name list, as well as ReservedNames did not yield any results. No collision on this name, add it! */
 	if (bIsParameter && FuncParamNames)
 	{
-		FuncParamNames->emplace_back(NameIdx, CurrentType);
-		return FuncParamNames->size() - 1;
+		return PushName(*FuncParamNames, *FuncParamLookup, NameInfo(NameIdx, CurrentType));
 	}
 	else
 	{
-		StructNames.emplace_back(NameIdx, CurrentType);
-		return StructNames.size() - 1;
+		return PushName(StructNames, StructLookup, NameInfo(NameIdx, CurrentType));
 	}
 }
 
@@ -207,7 +219,7 @@ void CollisionManager::AddReservedClassName(const std::string& Name, bool bIsPar
 	NewInfo.CollisionData = 0x0;
 	NewInfo.OwnType = static_cast<uint8>(bIsParameterOrLocalVariable ? ECollisionType::ParameterName : ECollisionType::SuperMemberName);
 
-	ClassReservedNames.push_back(NewInfo);
+	PushName(ClassReservedNames, ClassReservedNamesLookup, NewInfo);
 }
 
 void CollisionManager::AddReservedName(const std::string& Name)
@@ -217,7 +229,7 @@ void CollisionManager::AddReservedName(const std::string& Name)
 	NewInfo.CollisionData = 0x0;
 	NewInfo.OwnType = static_cast<uint8>(ECollisionType::MemberName);
 
-	ReservedNames.push_back(NewInfo);
+	PushName(ReservedNames, ReservedNamesLookup, NewInfo);
 }
 
 void CollisionManager::AddStructToNameContainer(UEStruct Struct, bool bIsStruct)
@@ -228,14 +240,25 @@ void CollisionManager::AddStructToNameContainer(UEStruct Struct, bool bIsStruct)
 			AddStructToNameContainer(Super, bIsStruct);
 	}
 
-	NameContainer& StructNames = NameInfos[Struct.GetIndex()];
+	auto ContainerAndLookup = GetContainerAndLookup(Struct.GetIndex());
+
+	NameContainer& StructNames = ContainerAndLookup.first;
+	NameLookup& StructLookup = ContainerAndLookup.second;
 
 	if (!StructNames.empty())
 		return;
 
+	/* Chain to the closest super with names, supers without any names can never collide */
+	if (UEStruct Super = Struct.GetSuper())
+	{
+		const NameLookup& SuperLookup = NameLookups.at(Super.GetIndex());
+
+		StructLookup.Super = !SuperLookup.LastIndexOfName.empty() ? &SuperLookup : SuperLookup.Super;
+	}
+
 	auto AddToContainerAndTranslationMap = [&](auto Member, ECollisionType CollisionType, bool bIsStruct, UEFunction Func = nullptr) -> void
 	{
-		const uint64 Index = AddNameToContainer(StructNames, Struct, MemberNames.FindOrAdd(Member.GetValidName()), CollisionType, bIsStruct, Func);
+		const uint64 Index = AddNameToContainer(StructNames, StructLookup, Struct, MemberNames.FindOrAdd(Member.GetValidName()), CollisionType, bIsStruct, Func);
 
 		const auto [It, bInserted] = TranslationMap.emplace(KeyFunctions::GetKeyForCollisionInfo(Struct, Member), Index);
 		
@@ -243,14 +266,14 @@ void CollisionManager::AddStructToNameContainer(UEStruct Struct, bool bIsStruct)
 			std::cout << "Error, no insertion took place, key {0x" << std::hex << KeyFunctions::GetKeyForCollisionInfo(Struct, Member) << "} duplicated!" << std::endl;
 	};
 
-	for (UEProperty Prop : Struct.GetProperties())
+	for (UEProperty Prop : Struct.IterateProperties())
 		AddToContainerAndTranslationMap(Prop, ECollisionType::MemberName, bIsStruct);
 
-	for (UEFunction Func : Struct.GetFunctions())
+	for (UEFunction Func : Struct.IterateFunctions())
 	{
 		AddToContainerAndTranslationMap(Func, ECollisionType::FunctionName, bIsStruct);
 
-		for (UEProperty Prop : Func.GetProperties())
+		for (UEProperty Prop : Func.IterateProperties())
 			AddToContainerAndTranslationMap(Prop, ECollisionType::ParameterName, bIsStruct, Func);
 	}
 };
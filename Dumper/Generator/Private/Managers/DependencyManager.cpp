@@ -1,4 +1,7 @@
+#include <stdexcept>
+
 #include "Managers/DependencyManager.h"
+#include "Menu/Logger.h"
 
 
 DependencyManager::DependencyManager(int32 ObjectToTrack)
@@ -9,16 +12,19 @@ DependencyManager::DependencyManager(int32 ObjectToTrack)
 void DependencyManager::SetExists(const int32 DepedantIdx)
 {
 	AllDependencies[DepedantIdx];
+	bIsGraphOutdated = true;
 }
 
 void DependencyManager::AddDependency(const int32 DepedantIdx, int32 DependencyIndex)
 {
 	AllDependencies[DepedantIdx].DependencyIndices.insert(DependencyIndex);
+	bIsGraphOutdated = true;
 }
 
 void DependencyManager::SetDependencies(const int32 DepedantIdx, std::unordered_set<int32>&& Dependencies)
 {
 	AllDependencies[DepedantIdx].DependencyIndices = std::move(Dependencies);
+	bIsGraphOutdated = true;
 }
 
 size_t DependencyManager::GetNumEntries() const
@@ -26,36 +32,49 @@ size_t DependencyManager::GetNumEntries() const
 	return AllDependencies.size();
 }
 
-void DependencyManager::VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const
+void DependencyManager::BuildGraphIfOutdated() const
 {
-	auto& [IterationHitCounter, Dependencies] = AllDependencies.at(Index);
-
-	if (IterationHitCounter >= CurrentIterationHitCount)
+	if (!bIsGraphOutdated)
 		return;
 
-	IterationHitCounter = CurrentIterationHitCount;
+	const int32 NumNodes = static_cast<int32>(AllDependencies.size());
 
-	for (int32 Dependency : Dependencies)
+	Graph.ObjectIndices.clear();
+	Graph.ObjectIndices.reserve(NumNodes);
+
+	for (const auto& [Index, DependencyInfo] : AllDependencies)
 	{
-		VisitIndexAndDependencies(Dependency, Callback);
+		DependencyInfo.LocalIndex = static_cast<int32>(Graph.ObjectIndices.size());
+		Graph.ObjectIndices.push_back(Index);
 	}
 
-	Callback(Index);
-}
+	Graph.EdgeBegin.clear();
+	Graph.EdgeBegin.reserve(NumNodes + 1);
+	Graph.Edges.clear();
 
-void DependencyManager::VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const
-{
-	CurrentIterationHitCount++;
+	for (const auto& [Index, DependencyInfo] : AllDependencies)
+	{
+		Graph.EdgeBegin.push_back(static_cast<int32>(Graph.Edges.size()));
 
-	VisitIndexAndDependencies(Index, Callback);
-}
+		for (int32 Dependency : DependencyInfo.DependencyIndices)
+		{
+			auto It = AllDependencies.find(Dependency);
 
-void DependencyManager::VisitAllNodesWithCallback(OnVisitCallbackType Callback) const
-{
-	CurrentIterationHitCount++;
+			/* Every dependency has to be a node itself, the recursive visitor threw from AllDependencies.at() in this case */
+			if (It == AllDependencies.end())
+			{
+				LogError("DependencyManager: object %d depends on object %d, which was never added", Index, Dependency);
+				throw std::out_of_range("Dependency was never added to the DependencyManager!");
+			}
 
-	for (const auto& [Index, DependencyInfo] : AllDependencies)
-	{
-		VisitIndexAndDependencies(Index, Callback);
+			Graph.Edges.push_back(It->second.LocalIndex);
+		}
 	}
+
+	Graph.EdgeBegin.push_back(static_cast<int32>(Graph.Edges.size()));
+
+	/* Iteration numbers only ever increase, so a zeroed array marks every node as not yet visited */
+	Graph.VisitedInIteration.assign(NumNodes, 0x0);
+
+	bIsGraphOutdated = false;
 }
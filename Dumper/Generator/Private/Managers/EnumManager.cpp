@@ -1,4 +1,5 @@
 #include "Managers/EnumManager.h"
+#include "Unreal/ReflectionSnapshot.h"
 
 namespace EnumInitHelper
 {
@@ -78,65 +79,51 @@ CollisionInfoIterator EnumInfoHandle::GetMemberCollisionInfoIterator() const
 
 void EnumManager::InitInternal()
 {
-	for (auto Obj : ObjectArray())
+	const ReflectionSnapshot::ObjectTable& Objects = ReflectionSnapshot::GetObjects();
+	const ReflectionSnapshot::StructTable& Structs = ReflectionSnapshot::GetStructs();
+	const ReflectionSnapshot::PropertyTable& Properties = ReflectionSnapshot::GetProperties();
+
+	for (int32 ObjIndex = 0; ObjIndex < Objects.Num(); ObjIndex++)
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+		if (!Objects.Address[ObjIndex] || (Objects.Flags[ObjIndex] & EObjectFlags::ClassDefaultObject))
 			continue;
 
-		if (Obj.IsA(EClassCastFlags::Struct))
+		if (ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Struct))
 		{
-			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+			const int32 Slot = Objects.StructSlot[ObjIndex];
+
+			const int32 FirstProperty = Structs.FirstProperty[Slot];
+			const int32 LastProperty = FirstProperty + Structs.NumProperties[Slot];
 
-			for (UEProperty Property : ObjAsStruct.GetProperties())
+			for (int32 i = FirstProperty; i < LastProperty; i++)
 			{
-				if (!Property.IsA(EClassCastFlags::EnumProperty) && !Property.IsA(EClassCastFlags::ByteProperty))
-					continue;
+				const EClassCastFlags PropertyCastFlags = Properties.CastFlags[i];
 
-				UEEnum Enum = nullptr;
-				UEProperty UnderlayingProperty = nullptr;
+				if (!(PropertyCastFlags & EClassCastFlags::EnumProperty) && !(PropertyCastFlags & EClassCastFlags::ByteProperty))
+					continue;
 
-				if (Property.IsA(EClassCastFlags::EnumProperty))
-				{
-					Enum = Property.Cast<UEEnumProperty>().GetEnum();
-					UnderlayingProperty = Property.Cast<UEEnumProperty>().GetUnderlayingProperty();
+				/* Enums without an underlaying property aren't used to determine the size */
+				if ((PropertyCastFlags & EClassCastFlags::EnumProperty) && !UEProperty(Properties.Address[i]).Cast<UEEnumProperty>().GetUnderlayingProperty())
+					continue;
 
-					if (!UnderlayingProperty)
-						continue;
-				}
-				else /* ByteProperty */
-				{
-					Enum = Property.Cast<UEByteProperty>().GetEnum();
-					UnderlayingProperty = Property;
-				}
+				const int32 EnumIndex = Properties.TypeIndex[i];
 
-				if (!Enum)
+				if (EnumIndex == ReflectionSnapshot::InvalidIndex)
 					continue;
 
-				EnumInfo& Info = EnumInfoOverrides[Enum.GetIndex()];
+				EnumInfo& Info = EnumInfoOverrides[EnumIndex];
 
+				/* The size of the property is the size of this enums underlaying type, which may be greater than the default size (0x1) */
 				Info.bWasInstanceFound = true;
-				Info.UnderlyingTypeSize = 0x1;
-
-				/* Check if the size of this enums underlaying type is greater than the default size (0x1) */
-				if (Enum)
-				{
-					Info.UnderlyingTypeSize = Property.GetSize();
-					continue;
-				}
-
-				if (UnderlayingProperty)
-				{
-					Info.UnderlyingTypeSize = UnderlayingProperty.GetSize();
-					continue;
-				}
+				Info.UnderlyingTypeSize = Properties.Size[i];
 			}
 		}
-		else if (Obj.IsA(EClassCastFlags::Enum))
+		else if (ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Enum))
 		{
-			UEEnum ObjAsEnum = Obj.Cast<UEEnum>();
+			UEEnum ObjAsEnum = ReflectionSnapshot::GetObject<UEEnum>(ObjIndex);
 
 			/* Add name to override info */
-			EnumInfo& NewOrExistingInfo = EnumInfoOverrides[Obj.GetIndex()];
+			EnumInfo& NewOrExistingInfo = EnumInfoOverrides[ObjIndex];
 			NewOrExistingInfo.Name = UniqueEnumNameTable.FindOrAdd(ObjAsEnum.GetEnumPrefixedName()).first;
 
 			uint64 EnumMaxValue = 0x0;
@@ -7,9 +7,14 @@
 
 MemberManager::MemberManager(UEStruct Str)
 	: Struct(std::make_shared<StructWrapper>(Str))
-	, Functions(Str.GetFunctions())
-	, Members(Str.GetProperties())
 {
+	// copied from the cached lists, so the child lists of a struct are only walked once no matter how many MemberManagers are built for it
+	const TCachedChildList<UEFunction> CachedFunctions = Str.GetCachedFunctions();
+	const TCachedChildList<UEProperty> CachedMembers = Str.GetCachedProperties();
+
+	Functions.assign(CachedFunctions.begin(), CachedFunctions.end());
+	Members.assign(CachedMembers.begin(), CachedMembers.end());
+
 	// sorts functions/members in O(n * log(n)), can be sorted via radix, O(n), but the overhead might not be worth it
 	std::sort(Functions.begin(), Functions.end(), CompareUnrealFunctions);
 	std::sort(Members.begin(), Members.end(), CompareUnrealProperties);
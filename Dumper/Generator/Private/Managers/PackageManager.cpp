@@ -1,5 +1,6 @@
 
 #include "Unreal/ObjectArray.h"
+#include "Unreal/ReflectionSnapshot.h"
 
 #include "Managers/PackageManager.h"
 
@@ -167,7 +168,7 @@ namespace PackageManagerUtils
 			if (!SignatureFunction)
 				return;
 
-			for (UEProperty DelegateParam : SignatureFunction.GetProperties())
+			for (UEProperty DelegateParam : SignatureFunction.GetCachedProperties())
 			{
 				GetPropertyDependency(DelegateParam, Store);
 			}
@@ -180,7 +181,7 @@ namespace PackageManagerUtils
 
 		const int32 StructIdx = Struct.GetIndex();
 
-		for (UEProperty Property : Struct.GetProperties())
+		for (UEProperty Property : Struct.GetCachedProperties())
 		{
 			GetPropertyDependency(Property, Dependencies);
 		}
@@ -246,28 +247,34 @@ void PackageManager::InitDependencies()
 {
 	// Collects all packages required to compile this file
 
-	for (auto Obj : ObjectArray())
+	const ReflectionSnapshot::ObjectTable& Objects = ReflectionSnapshot::GetObjects();
+	const ReflectionSnapshot::StructTable& Structs = ReflectionSnapshot::GetStructs();
+	const ReflectionSnapshot::FunctionTable& Functions = ReflectionSnapshot::GetFunctions();
+
+	for (int32 ObjIndex = 0; ObjIndex < Objects.Num(); ObjIndex++)
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+		if (!Objects.Address[ObjIndex] || (Objects.Flags[ObjIndex] & EObjectFlags::ClassDefaultObject))
 			continue;
 
-		int32 CurrentPackageIdx = Obj.GetPackageIndex();
+		int32 CurrentPackageIdx = Objects.PackageIndex[ObjIndex];
 
-		const bool bIsStruct = Obj.IsA(EClassCastFlags::Struct);
-		const bool bIsClass = Obj.IsA(EClassCastFlags::Class);
+		const bool bIsStruct = ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Struct);
+		const bool bIsClass = ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Class);
 
-		const bool bIsFunction = Obj.IsA(EClassCastFlags::Function);
-		const bool bIsEnum = Obj.IsA(EClassCastFlags::Enum);
+		const bool bIsFunction = ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Function);
+		const bool bIsEnum = ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Enum);
 
 		if (bIsStruct && !bIsFunction)
 		{
 			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
 			Info.PackageIndex = CurrentPackageIdx;
 
-			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+			UEStruct ObjAsStruct = ReflectionSnapshot::GetObject<UEStruct>(ObjIndex);
+
+			const int32 Slot = Objects.StructSlot[ObjIndex];
 
-			const int32 StructIdx = ObjAsStruct.GetIndex();
-			const int32 StructPackageIdx = ObjAsStruct.GetPackageIndex();
+			const int32 StructIdx = ObjIndex;
+			const int32 StructPackageIdx = CurrentPackageIdx;
 
 			DependencyListType& PackageDependencyList = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
 			DependencyManager& ClassOrStructDependencyList = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
@@ -282,14 +289,14 @@ void PackageManager::InitDependencies()
 				PackageManagerUtils::AddStructDependencies(ClassOrStructDependencyList, Dependencies, StructIdx, StructPackageIdx);
 
 			/* for both struct and class */
-			if (UEStruct Super = ObjAsStruct.GetSuper())
+			if (const int32 SuperIdx = Structs.SuperIndex[Slot]; SuperIdx != ReflectionSnapshot::InvalidIndex)
 			{
-				const int32 SuperPackageIdx = Super.GetPackageIndex();
+				const int32 SuperPackageIdx = Objects.PackageIndex[SuperIdx];
 
 				if (SuperPackageIdx == StructPackageIdx)
 				{
 					/* In-file sorting is only required if the super-class is inside of the same package */
-					ClassOrStructDependencyList.AddDependency(Obj.GetIndex(), Super.GetIndex());
+					ClassOrStructDependencyList.AddDependency(ObjIndex, SuperIdx);
 				}
 				else
 				{
@@ -304,15 +311,21 @@ void PackageManager::InitDependencies()
 				continue;
 			
 			/* Add class-functions to package */
-			for (UEFunction Func : ObjAsStruct.GetFunctions())
+			const int32 FirstFunction = Structs.FirstFunction[Slot];
+			const int32 LastFunction = FirstFunction + Structs.NumFunctions[Slot];
+
+			for (int32 i = FirstFunction; i < LastFunction; i++)
 			{
-				Info.Functions.push_back(Func.GetIndex());
+				const int32 FuncIdx = Functions.ObjectIndex[i];
+				const int32 FuncSlot = ReflectionSnapshot::GetStructSlot(FuncIdx);
+
+				Info.Functions.push_back(FuncIdx);
 
-				std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
+				std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(ReflectionSnapshot::GetObject<UEFunction>(FuncIdx), FuncIdx);
 
-				BooleanOrEqual(Info.bHasParams, Func.HasMembers());
+				BooleanOrEqual(Info.bHasParams, FuncSlot != ReflectionSnapshot::InvalidIndex && Structs.NumProperties[FuncSlot] > 0);
 
-				const int32 FuncPackageIndex = Func.GetPackageIndex();
+				const int32 FuncPackageIndex = Objects.PackageIndex[FuncIdx];
 
 				/* Add dependencies to ParamDependencies and add enums only to class dependencies (forwarddeclaration of enum classes defaults to int) */
 				PackageManagerUtils::SetPackageDependencies(Info.PackageDependencies.ParametersDependencies, ParamDependencies, FuncPackageIndex, true);
@@ -324,7 +337,7 @@ void PackageManager::InitDependencies()
 			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
 			Info.PackageIndex = CurrentPackageIdx;
 
-			Info.Enums.push_back(Obj.GetIndex());
+			Info.Enums.push_back(ObjIndex);
 		}
 	}
 }
@@ -354,7 +367,7 @@ void PackageManager::HelperMarkStructDependenciesOfPackage(UEStruct Struct, int3
 	if (bIsClass)
 		return;
 
-	for (UEProperty Child : Struct.GetProperties())
+	for (UEProperty Child : Struct.GetCachedProperties())
 	{
 		if (!Child.IsA(EClassCastFlags::StructProperty))
 			continue;
@@ -379,7 +392,7 @@ int32 PackageManager::HelperCountStructDependenciesOfPackage(UEStruct Struct, in
 	if (bIsClass)
 		return RetCount;
 
-	for (UEProperty Child : Struct.GetProperties())
+	for (UEProperty Child : Struct.GetCachedProperties())
 	{
 		if (!Child.IsA(EClassCastFlags::StructProperty))
 			continue;
@@ -395,7 +408,7 @@ int32 PackageManager::HelperCountStructDependenciesOfPackage(UEStruct Struct, in
 
 void PackageManager::HelperAddEnumsFromPacakageToFwdDeclarations(UEStruct Struct, std::vector<std::pair<int32, bool>>& EnumsToForwardDeclare, int32 RequiredPackageIdx, bool bMarkAsClass)
 {
-	for (UEProperty Child : Struct.GetProperties())
+	for (UEProperty Child : Struct.GetCachedProperties())
 	{
 		const bool bIsEnumPrperty = Child.IsA(EClassCastFlags::EnumProperty);
 		const bool bIsBytePrperty = Child.IsA(EClassCastFlags::ByteProperty);
@@ -416,7 +429,7 @@ void PackageManager::HelperInitEnumFwdDeclarationsForPackage(int32 PackageForFwd
 
 	std::vector<std::pair<int32, bool>>& EnumsToForwardDeclare = Info.EnumForwardDeclarations;
 
-	DependencyManager::OnVisitCallbackType CheckForEnumsToForwardDeclareCallback = [&EnumsToForwardDeclare, RequiredPackage, bIsClass](int32 Index) -> void
+	auto CheckForEnumsToForwardDeclareCallback = [&EnumsToForwardDeclare, RequiredPackage, bIsClass](int32 Index) -> void
 	{
 		HelperAddEnumsFromPacakageToFwdDeclarations(ObjectArray::GetByIndex<UEStruct>(Index), EnumsToForwardDeclare, RequiredPackage, bIsClass);
 	};
@@ -494,7 +507,7 @@ void PackageManager::HandleCycles()
 			/* Number of structs from PreviousPackage required by CurrentPackage */
 			int32 NumStructsRequiredByCurrent = 0x0;
 
-			DependencyManager::OnVisitCallbackType CountDependenciesForCurrent = [&NumStructsRequiredByCurrent, PreviousPackageIndex, bIsStruct](int32 Index) -> void
+			auto CountDependenciesForCurrent = [&NumStructsRequiredByCurrent, PreviousPackageIndex, bIsStruct](int32 Index) -> void
 			{
 				NumStructsRequiredByCurrent += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PreviousPackageIndex, !bIsStruct);
 			};
@@ -504,7 +517,7 @@ void PackageManager::HandleCycles()
 			/* Number of structs from CurrentPackage required by CurrentPackage PreviousPackage */
 			int32 NumStructsRequiredByPrevious = 0x0;
 
-			DependencyManager::OnVisitCallbackType CountDependenciesForPrevious = [&NumStructsRequiredByPrevious, CurrentPackageIndex, bIsStruct](int32 Index) -> void
+			auto CountDependenciesForPrevious = [&NumStructsRequiredByPrevious, CurrentPackageIndex, bIsStruct](int32 Index) -> void
 			{
 				NumStructsRequiredByPrevious += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), CurrentPackageIndex, !bIsStruct);
 			};
@@ -522,7 +535,7 @@ void PackageManager::HandleCycles()
 			HandledPackages.push_back({ PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct, !bIsStruct });
 
 
-			DependencyManager::OnVisitCallbackType SetCycleCallback = [PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct](int32 Index) -> void
+			auto SetCycleCallback = [PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct](int32 Index) -> void
 			{
 				HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PackageIndexToMarkCyclicWith, PackageIndexWithLeastDependencies, !bIsStruct);
 			};
@@ -533,7 +546,7 @@ void PackageManager::HandleCycles()
 		{
 			HandledPackages.push_back({ PreviousPackageIndex, CurrentPackageIndex, bIsStruct, !bIsStruct });
 
-			DependencyManager::OnVisitCallbackType SetCycleCallback = [PreviousPackageIndex, CurrentPackageIndex, bIsStruct](int32 Index) -> void
+			auto SetCycleCallback = [PreviousPackageIndex, CurrentPackageIndex, bIsStruct](int32 Index) -> void
 			{
 				HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PreviousPackageIndex, CurrentPackageIndex, !bIsStruct);
 			};
@@ -1,5 +1,6 @@
 
 #include "Unreal/ObjectArray.h"
+#include "Unreal/ReflectionSnapshot.h"
 #include "Managers/StructManager.h"
 
 #include "Menu/Logger.h"
@@ -61,20 +62,22 @@ void StructManager::InitAlignmentsAndNames()
 	constexpr int32 DefaultClassAlignment = 0x8;
 
 	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+	const int32 InterfaceClassIndex = InterfaceClass ? InterfaceClass.GetIndex() : ReflectionSnapshot::InvalidIndex;
 
-	for (auto Obj : ObjectArray())
-	{
-		if (!Obj.IsA(EClassCastFlags::Struct) /* || Obj.IsA(EClassCastFlags::Function)*/)
-			continue;
+	const ReflectionSnapshot::StructTable& Structs = ReflectionSnapshot::GetStructs();
+	const ReflectionSnapshot::PropertyTable& Properties = ReflectionSnapshot::GetProperties();
 
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+	for (int32 Slot = 0; Slot < Structs.Num(); Slot++)
+	{
+		const int32 ObjIndex = Structs.ObjectIndex[Slot];
+		const bool bIsFunction = ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Function);
 
 		// Add name to override info
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
-		NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(Obj.GetCppName(), !Obj.IsA(EClassCastFlags::Function)).first;
+		StructInfo& NewOrExistingInfo = StructInfoOverrides[ObjIndex];
+		NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(ReflectionSnapshot::GetObject(ObjIndex).GetCppName(), !bIsFunction).first;
 
 		// Interfaces inherit from UObject by default, but as a workaround to no virtual-inheritance we make them empty
-		if (ObjAsStruct.HasType(InterfaceClass))
+		if (ReflectionSnapshot::HasType(Slot, InterfaceClassIndex))
 		{
 			NewOrExistingInfo.Alignment = 0x1;
 			NewOrExistingInfo.bHasReusedTrailingPadding = false;
@@ -84,23 +87,26 @@ void StructManager::InitAlignmentsAndNames()
 			continue;
 		}
 
-		int32 MinAlignment = ObjAsStruct.GetMinAlignment();
+		int32 MinAlignment = Structs.MinAlignment[Slot];
 		int32 HighestMemberAlignment = 0x1; // starting at 0x1 when checking **all**, not just struct-properties
 
 		// Find member with the highest alignment
-		for (UEProperty Property : ObjAsStruct.GetProperties())
+		const int32 FirstProperty = Structs.FirstProperty[Slot];
+		const int32 LastProperty = FirstProperty + Structs.NumProperties[Slot];
+
+		for (int32 i = FirstProperty; i < LastProperty; i++)
 		{
-			int32 CurrentPropertyAlignment = Property.GetAlignment();
+			int32 CurrentPropertyAlignment = Properties.Alignment[i];
 
 			if (CurrentPropertyAlignment > HighestMemberAlignment)
 				HighestMemberAlignment = CurrentPropertyAlignment;
 		}
 
 		/* On some strange games there are BlueprintGeneratedClass UClasses which don't inherit from UObject. */
-		const bool bHasSuperClass = static_cast<bool>(ObjAsStruct.GetSuper());
+		const bool bHasSuperClass = Structs.SuperIndex[Slot] != ReflectionSnapshot::InvalidIndex;
 
 		// if Class alignment is below pointer-alignment (0x8), use pointer-alignment instead, else use whichever, MinAlignment or HighestAlignment, is bigger
-		if (ObjAsStruct.IsA(EClassCastFlags::Class) && bHasSuperClass && HighestMemberAlignment < DefaultClassAlignment)
+		if (ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Class) && bHasSuperClass && HighestMemberAlignment < DefaultClassAlignment)
 		{
 			NewOrExistingInfo.bUseExplicitAlignment = false;
 			NewOrExistingInfo.Alignment = DefaultClassAlignment;
@@ -112,22 +118,20 @@ void StructManager::InitAlignmentsAndNames()
 		}
 	}
 
-	for (auto Obj : ObjectArray())
+	for (int32 Slot = 0; Slot < Structs.Num(); Slot++)
 	{
-		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function) || Obj.Cast<UEStruct>().HasType(InterfaceClass))
+		if (ReflectionSnapshot::IsA(Structs.ObjectIndex[Slot], EClassCastFlags::Function) || ReflectionSnapshot::HasType(Slot, InterfaceClassIndex))
 			continue;
 
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
-
 		constexpr int MaxNumSuperClasses = 0x30;
 
-		std::array<UEStruct, MaxNumSuperClasses> StructStack;
+		std::array<int32, MaxNumSuperClasses> StructStack;
 		int32 NumElementsInStructStack = 0x0;
 
 		// Get a top to bottom list of a struct and all of its supers
-		for (UEStruct S = ObjAsStruct; S; S = S.GetSuper())
+		for (int32 S = Slot; S != ReflectionSnapshot::InvalidIndex; S = ReflectionSnapshot::GetStructSlot(Structs.SuperIndex[S]))
 		{
-			StructStack[NumElementsInStructStack] = S;
+			StructStack[NumElementsInStructStack] = Structs.ObjectIndex[S];
 			NumElementsInStructStack++;
 		}
 
@@ -135,7 +139,7 @@ void StructManager::InitAlignmentsAndNames()
 
 		for (int i = NumElementsInStructStack - 1; i >= 0; i--)
 		{
-			StructInfo& Info = StructInfoOverrides[StructStack[i].GetIndex()];
+			StructInfo& Info = StructInfoOverrides[StructStack[i]];
 
 			if (CurrentHighestAlignment < Info.Alignment)
 			{
@@ -154,33 +158,40 @@ void StructManager::InitAlignmentsAndNames()
 void StructManager::InitSizesAndIsFinal()
 {
 	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+	const int32 InterfaceClassIndex = InterfaceClass ? InterfaceClass.GetIndex() : ReflectionSnapshot::InvalidIndex;
+
+	const ReflectionSnapshot::StructTable& Structs = ReflectionSnapshot::GetStructs();
+	const ReflectionSnapshot::PropertyTable& Properties = ReflectionSnapshot::GetProperties();
 
-	for (auto Obj : ObjectArray())
+	for (int32 Slot = 0; Slot < Structs.Num(); Slot++)
 	{
-		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.Cast<UEStruct>().HasType(InterfaceClass))
+		if (ReflectionSnapshot::HasType(Slot, InterfaceClassIndex))
 			continue;
 
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+		const int32 ObjIndex = Structs.ObjectIndex[Slot];
 
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
+		StructInfo& NewOrExistingInfo = StructInfoOverrides[ObjIndex];
 
 		// Initialize struct-size if it wasn't set already
-		if (NewOrExistingInfo.Size > ObjAsStruct.GetStructSize())
-			NewOrExistingInfo.Size = ObjAsStruct.GetStructSize();
+		if (NewOrExistingInfo.Size > Structs.Size[Slot])
+			NewOrExistingInfo.Size = Structs.Size[Slot];
 
-		UEStruct Super = ObjAsStruct.GetSuper();
+		const int32 SuperSlot = ReflectionSnapshot::GetStructSlot(Structs.SuperIndex[Slot]);
 
-		if (NewOrExistingInfo.Size == 0x0 && Super != nullptr)
-			NewOrExistingInfo.Size = Super.GetStructSize();
+		if (NewOrExistingInfo.Size == 0x0 && SuperSlot != ReflectionSnapshot::InvalidIndex)
+			NewOrExistingInfo.Size = Structs.Size[SuperSlot];
 
 		int32 LastMemberEnd = 0x0;
 		int32 LowestOffset = INT_MAX;
 
 		// Find member with the lowest offset
-		for (UEProperty Property : ObjAsStruct.GetProperties())
+		const int32 FirstProperty = Structs.FirstProperty[Slot];
+		const int32 LastProperty = FirstProperty + Structs.NumProperties[Slot];
+
+		for (int32 i = FirstProperty; i < LastProperty; i++)
 		{
-			const int32 PropertyOffset = Property.GetOffset();
-			const int32 PropertySize = Property.GetSize();
+			const int32 PropertyOffset = Properties.Offset[i];
+			const int32 PropertySize = Properties.Size[i];
 
 			if (PropertyOffset < LowestOffset)
 				LowestOffset = PropertyOffset;
@@ -192,7 +203,7 @@ void StructManager::InitSizesAndIsFinal()
 		/* No need to check any other structs, as finding the LastMemberEnd only involves this struct */
 		NewOrExistingInfo.LastMemberEnd = LastMemberEnd;
 
-		if (!Super || Obj.IsA(EClassCastFlags::Function))
+		if (SuperSlot == ReflectionSnapshot::InvalidIndex || ReflectionSnapshot::IsA(ObjIndex, EClassCastFlags::Function))
 			continue;
 
 		/*
@@ -200,9 +211,9 @@ void StructManager::InitSizesAndIsFinal()
 		* 
 		* breaks out of the loop after encountering a super-struct which is not empty (aka. has member-variables)
 		*/
-		for (UEStruct S = Super; S; S = S.GetSuper())
+		for (int32 S = SuperSlot; S != ReflectionSnapshot::InvalidIndex; S = ReflectionSnapshot::GetStructSlot(Structs.SuperIndex[S]))
 		{
-			auto It = StructInfoOverrides.find(S.GetIndex());
+			auto It = StructInfoOverrides.find(Structs.ObjectIndex[S]);
 
 			if (It == StructInfoOverrides.end())
 			{
@@ -216,7 +227,7 @@ void StructManager::InitSizesAndIsFinal()
 			// Struct is not final, as it is another structs' super
 			Info.bIsFinal = false;
 
-			const int32 SizeToCheck = Info.Size == INT_MAX ? S.GetStructSize() : Info.Size;
+			const int32 SizeToCheck = Info.Size == INT_MAX ? Structs.Size[S] : Info.Size;
 
 			// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
 			if (Align(SizeToCheck, Info.Alignment) > LowestOffset)
@@ -227,7 +238,7 @@ void StructManager::InitSizesAndIsFinal()
 				Info.bHasReusedTrailingPadding = true;
 			}
 
-			if (S.HasMembers())
+			if (Structs.NumProperties[S] > 0)
 				break;
 		}
 	}
@@ -12,6 +12,7 @@
 #include "Managers/PackageManager.h"
 
 #include "HashStringTable.h"
+#include "IO/BufferedFileWriter.h"
 #include "Generator.h"
 
 
@@ -70,7 +71,7 @@ private:
     };
 
 private:
-    using StreamType = std::ofstream;
+    using StreamType = BufferedFileWriter;
 
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
@@ -84,6 +85,10 @@ public:
 private:
     static inline std::vector<PredefinedStruct> PredefinedStructs;
 
+    /* Sizes used for cycle-fixups, set by Generate() before any package-worker is started */
+    static inline int32 UObjectSize = 0x0;
+    static inline int32 AActorSize = 0x0;
+
 private:
     static std::string MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment);
     static std::string MakeMemberStringWithoutName(const std::string& Type);
@@ -102,6 +107,12 @@ private:
 
     static void GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile);
 
+    /* Writes the _classes.hpp, _structs.hpp, _parameters.hpp and _functions.cpp files of one package into 'PackageFolder', may run on any generator thread */
+    static void GeneratePackage(PackageInfoHandle Package, const fs::path& PackageFolder);
+
+    /* Generates all packages again on a single thread and compares the result to the files written by the package-workers */
+    static bool VerifyParallelPackageOutput(const std::vector<PackageInfoHandle>& Packages);
+
 private: /* utility functions */
     static std::string GetMemberTypeString(const PropertyWrapper& MemberWrapper, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false /* const USomeClass* Member; */);
     static std::string GetMemberTypeString(UEProperty Member, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
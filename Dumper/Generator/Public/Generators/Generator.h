@@ -6,6 +6,8 @@
 #include "Managers/DependencyManager.h"
 #include "Managers/MemberManager.h"
 #include "HashStringTable.h"
+#include "IO/BufferedFileWriter.h"
+#include "Memory/MemoryReader.h"
 
 
 namespace fs = std::filesystem;
@@ -57,6 +59,13 @@ public:
     template<GeneratorImplementation GeneratorType>
     static void Generate() 
     { 
+        /* Every generator walks GObjects again, readability cached by the previous one might be outdated */
+        Memory::InvalidateRegionCache();
+
+        /* The game keeps running between generators, objects might have been created in slots freed by garbage collection */
+        if (Memory::IsLive())
+            ObjectArray::RebuildNameIndex();
+
         if (DumperFolder.empty())
         {
             if (!SetupDumperFolder())
@@ -81,5 +90,7 @@ public:
         MemberManager::SetPredefinedMemberLookupPtr(&GeneratorType::PredefinedMembers);
 
         GeneratorType::Generate();
+
+        BufferedFileWriter::LogTotalStats();
     };
 };
@@ -1,10 +1,14 @@
 #pragma once
 
-#include <iostream>
+#include <vector>
 #include <string>
+#include <iostream>
+#include <string_view>
+#include <unordered_map>
 
 #include "Unreal/ObjectArray.h"
 #include "PredefinedMembers.h"
+#include "IO/BufferedFileWriter.h"
 
 
 class IDAMappingGenerator
@@ -19,7 +23,42 @@ public:
     static inline fs::path Subfolder;
 
 private:
-    using StreamType = std::ofstream;
+    using StreamType = BufferedFileWriter;
+
+private:
+    /* One name, the string is stored in NameBlob */
+    struct IdmapRecord
+    {
+        uint32 Offset;
+        uint32 NameOffset;
+        uint16 NameLength;
+    };
+
+    /* Header of the '.idmapidx' file, followed by IdmapIndexEntry[NumEntries] and the string blob */
+    struct IdmapIndexHeader
+    {
+        char Magic[4];
+        uint32 Version;
+        uint32 NumEntries;
+        uint32 StringBlobSize;
+    };
+
+    struct IdmapIndexEntry
+    {
+        uint32 Offset;
+        uint32 NameOffset; // Relative to the start of the string blob
+        uint32 NameLength;
+    };
+
+    static constexpr char IdmapIndexMagic[4] = { 'D', '7', 'I', 'X' };
+    static constexpr uint32 IdmapIndexVersion = 1;
+
+private:
+    static inline std::vector<IdmapRecord> Records;
+    static inline std::string NameBlob;
+
+    /* VFT of the default object of a class, by class-index */
+    static inline std::unordered_map<int32, void*> ClassVftCache;
 
 private:
     template<typename InStreamType, typename T>
@@ -35,13 +74,24 @@ private:
     }
 
 private:
-    static std::string MangleFunctionName(const std::string& ClassName, const std::string& FunctionName);
+    static void AppendMangledFunctionName(std::string& Out, std::string_view ClassName, std::string_view FunctionName);
+
+    static void* GetClassVft(UEClass Class);
+
+    /* Adds a record for the name currently at the end of NameBlob, starting at NameStart */
+    static void AddRecord(uint32 Offset, size_t NameStart);
+
+    /* Sorts Records by offset and removes all but the first record for every offset */
+    static void SortAndRemoveDuplicates();
 
 private:
     static void WriteReadMe(StreamType& ReadMe);
 
-    static void GenerateVTableName(StreamType& IdmapFile, UEObject DefaultObject);
-    static void GenerateClassFunctions(StreamType& IdmapFile, UEClass Class);
+    static void GenerateVTableName(UEObject DefaultObject);
+    static void GenerateClassFunctions(UEClass Class);
+
+    static void WriteIdmap(StreamType& IdmapFile);
+    static void WriteBinaryIndex(StreamType& IndexFile);
 
 public:
     static void Generate();
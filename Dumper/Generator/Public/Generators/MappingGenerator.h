@@ -1,6 +1,11 @@
 #pragma once
 
+#include <deque>
+#include <memory>
+#include <string>
 #include <fstream>
+#include <string_view>
+#include <unordered_map>
 
 #include "Unreal/ObjectArray.h"
 #include "Wrappers/MemberWrappers.h"
@@ -84,12 +89,43 @@ private:
         LatestPlusOne,
     };
 
+    /* Payload of the file, the sections are written to the file in this order (Count followed by Data) without being concatenated first */
+    struct UsmapPayload
+    {
+        uint32 NumNames = 0x0;
+        std::string NameData;
+
+        uint32 NumEnums = 0x0;
+        std::string EnumData;
+
+        uint32 NumStructs = 0x0;
+        std::string StructData;
+
+        inline uint64 GetSize() const
+        {
+            return (sizeof(uint32) * 3) + NameData.size() + EnumData.size() + StructData.size();
+        }
+    };
+
 private:
     static constexpr uint16 UsmapFileMagic = 0x30C4;
 
+    static constexpr int32 NameIndexPageBits = 16;
+    static constexpr int32 NameIndexPageSize = 1 << NameIndexPageBits;
+
 private:
     static inline uint64 NameCounter = 0x0;
 
+    /* Every name added to the name-table, in order. Only written to the payload once all structs and enums were generated */
+    static inline std::deque<std::string> UniqueNames;
+
+    /* Index of each name in UniqueNames, only used if bShouldCheckForDuplicatedNames is enabled */
+    static inline std::unordered_map<std::string_view, int32> NameIndexByString;
+
+    /* (Index + 1) of every FName that was already added, paged by comparison-index and allocated on first use. 0 -> not added yet. */
+    static inline std::vector<std::unique_ptr<uint32[]>> NameIndexByCompIdx;
+    static inline std::unordered_map<uint64, int32> NameIndexByNumberedName;
+
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
 
@@ -106,26 +142,45 @@ private:
         InStream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
     }
 
-    template<typename InStreamType>
-    static void WriteToStream(InStreamType& InStream, const std::stringstream& Data)
+    template<typename T>
+    static void WriteToStream(std::string& Buffer, T Value)
     {
-        InStream << Data.rdbuf();
+        Buffer.append(reinterpret_cast<const char*>(&Value), sizeof(T));
     }
 
 private:
     /* Utility Functions */
     static EMappingsTypeFlags GetMappingType(UEProperty Property);
-    static int32 AddNameToData(std::stringstream& NameTable, const std::string& Name);
+    static void ResetNameTable();
+
+    static int32 AddNameToData(std::string_view Name);
+
+    /* Decodes every FName only once, no matter how often it's referenced */
+    static int32 AddNameToData(FName Name);
+
+    template<typename UEType>
+    static int32 AddObjectNameToData(UEType Object)
+    {
+        return Object ? AddNameToData(Object.GetFName()) : AddNameToData(std::string_view("None"));
+    }
+
+    static void WriteNameTable(UsmapPayload& Payload);
 
 private:
-    static void GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable);
-    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index);
+    static void GeneratePropertyType(UEProperty Property, std::string& Data);
+    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::string& Data, int32& Index);
+
+    static void GenerateStruct(const StructWrapper& Struct, std::string& Data);
+    static void GenerateEnum(const EnumWrapper& Enum, std::string& Data);
+
+    static UsmapPayload GenerateFileData();
 
-    static void GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable);
-    static void GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable);
+    /* Writes the payload section by section and returns the number of bytes written, or 0 on failure */
+    static uint64 WritePayloadUncompressed(StreamType& InUsmap, const UsmapPayload& Payload);
+    static uint64 WritePayloadZStandard(StreamType& InUsmap, const UsmapPayload& Payload);
 
-    static std::stringstream GenerateFileData();
-    static void GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data);
+    /* Returns the size of the usmap, a failed compression can leave bytes behind it that need to be truncated */
+    static std::streampos WriteFile(StreamType& InUsmap, const UsmapPayload& Payload);
 
 public:
     static void Generate();
@@ -3,6 +3,8 @@
 #include <cassert>
 #include <format>
 #include <iostream>
+#include <vector>
+#include <cstring>
 
 #include "Unreal/Enums.h"
 #include "Settings.h"
@@ -35,6 +37,55 @@ inline uint8 SmallPearsonHash(const char* StringToHash)
     return (Hash & HashMask);
 }
 
+/* wyhash-style 64-bit hash, used for the lookup-index of HashStringTable */
+inline uint64 WyMix(uint64 A, uint64 B)
+{
+    const __uint128_t Product = static_cast<__uint128_t>(A) * B;
+
+    return static_cast<uint64>(Product) ^ static_cast<uint64>(Product >> 64);
+}
+
+inline uint64 HashString64(const void* Data, size_t Size, uint64 Seed = 0x0)
+{
+    constexpr uint64 Secret0 = 0xA0761D6478BD642Full;
+    constexpr uint64 Secret1 = 0xE7037ED1A0B428DBull;
+    constexpr uint64 Secret2 = 0x8EBC6AF09C88C6E3ull;
+
+    const uint8* Bytes = static_cast<const uint8*>(Data);
+
+    auto Read64 = [](const uint8* Ptr) -> uint64 { uint64 Value; memcpy(&Value, Ptr, sizeof(Value)); return Value; };
+    auto Read32 = [](const uint8* Ptr) -> uint64 { uint32 Value; memcpy(&Value, Ptr, sizeof(Value)); return Value; };
+
+    uint64 Hash = Seed ^ WyMix(Seed ^ Secret0, Secret1);
+    uint64 A = 0x0;
+    uint64 B = 0x0;
+
+    if (Size <= 0x10)
+    {
+        if (Size >= 0x4)
+        {
+            A = (Read32(Bytes) << 32) | Read32(Bytes + ((Size >> 3) << 2));
+            B = (Read32(Bytes + Size - 4) << 32) | Read32(Bytes + Size - 4 - ((Size >> 3) << 2));
+        }
+        else if (Size > 0x0)
+        {
+            A = (static_cast<uint64>(Bytes[0]) << 16) | (static_cast<uint64>(Bytes[Size >> 1]) << 8) | Bytes[Size - 1];
+        }
+    }
+    else
+    {
+        size_t Remaining = Size;
+
+        for (; Remaining > 0x10; Remaining -= 0x10, Bytes += 0x10)
+            Hash = WyMix(Read64(Bytes) ^ Secret1, Read64(Bytes + 8) ^ Hash);
+
+        A = Read64(Bytes + Remaining - 0x10);
+        B = Read64(Bytes + Remaining - 0x8);
+    }
+
+    return WyMix(Secret1 ^ Size, WyMix(A ^ Secret1, B ^ Hash) ^ Secret2);
+}
+
 /* Used to limit access to StringEntry::OptionalCollisionCount to authorized (friend) classes only */
 struct AccessLimitedCollisionCount
 {
@@ -179,9 +230,30 @@ private:
         uint32 SizeMax;
     };
 
+    /* Slot in the open-addressing lookup-index, an empty slot has Index == InvalidIndex */
+    struct IndexSlot
+    {
+        uint64 FullHash;
+        HashStringTableIndex Index;
+    };
+
+private:
+    /* Grow the index once it's more than half full */
+    static constexpr uint64 IndexMaxLoadNumerator = 1;
+    static constexpr uint64 IndexMaxLoadDenominator = 2;
+
+    static constexpr uint64 InitialIndexSize = 0x400;
+
 private:
     StringBucket Buckets[NumBuckets];
 
+    /*
+    * Maps the full 64-bit hash of every string to its position in the buckets. Lookups use linear probing on this index instead of
+    * walking a whole bucket, the packed bucket storage (and therefore the iteration order) is unchanged.
+    */
+    std::vector<IndexSlot> LookupIndex;
+    uint64 NumIndexedEntries = 0x0;
+
 public:
     HashStringTable(uint32 InitialBucketSize = 0x5000);
     ~HashStringTable();
@@ -281,6 +353,12 @@ private:
 
     void ResizeBucket(StringBucket& Bucket);
 
+    template<typename CharType>
+    static uint64 GetFullHash(const CharType* Str, int32 Length);
+
+    void InsertIntoIndex(uint64 FullHash, HashStringTableIndex Index);
+    void GrowIndex();
+
     template<typename CharType>
     std::pair<HashStringTableIndex, bool> AddUnchecked(const CharType* Str, int32 Length, uint8 Hash);
 
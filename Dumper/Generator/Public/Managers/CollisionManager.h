@@ -106,7 +106,29 @@ private:
 public:
 	using NameContainer = std::vector<NameInfo>;
 
+	/*
+	* Hash-index over a NameContainer, maps a name to the index of the last NameInfo with that name in the container.
+	* 
+	* Struct-lookups are chained to the lookup of the closest super that contains any names. Supers are always fully added
+	* before their children, so a chained lookup never changes after a child has started to reference it.
+	*/
+	struct NameLookup
+	{
+		std::unordered_map<int32, uint32> LastIndexOfName;
+
+		const NameContainer* Names = nullptr;
+		const NameLookup* Super = nullptr;
+
+		inline const NameInfo* Find(HashStringTableIndex NameIdx) const
+		{
+			auto It = LastIndexOfName.find(NameIdx);
+
+			return It != LastIndexOfName.end() ? &(*Names)[It->second] : nullptr;
+		}
+	};
+
 	using NameInfoMapType = std::unordered_map<uint64, NameContainer>;
+	using NameLookupMapType = std::unordered_map<uint64, NameLookup>;
 	using TranslationMapType = std::unordered_map<uint64, uint64>;
 
 private:
@@ -116,6 +138,9 @@ private:
 	/* Member-names and name-collision info*/
 	CollisionManager::NameInfoMapType NameInfos;
 
+	/* Lookup for every container in NameInfos, same keys. Elements of unordered_maps are never moved, so pointers between them stay valid */
+	CollisionManager::NameLookupMapType NameLookups;
+
 	/* Map to translation from UEProperty/UEFunction to Index in NameContainer */
 	CollisionManager::TranslationMapType TranslationMap;
 
@@ -125,9 +150,25 @@ private:
 	/* Names reserved for all members/parameters. Eg. "float", "operator", "return", ... */
 	NameContainer ReservedNames;
 
+	NameLookup ClassReservedNamesLookup = { {}, &ClassReservedNames, nullptr };
+	NameLookup ReservedNamesLookup = { {}, &ReservedNames, nullptr };
+
+public:
+	CollisionManager() = default;
+
+	/* The lookups point into this instance's own containers, a copy would keep pointing into the original */
+	CollisionManager(const CollisionManager&) = delete;
+	CollisionManager& operator=(const CollisionManager&) = delete;
+
 private:
+	/* Returns the container and its lookup for the given key, linking them up on first use */
+	std::pair<NameContainer&, NameLookup&> GetContainerAndLookup(uint64 Key);
+
+	/* Appends Info to Container and returns its index */
+	static uint64 PushName(NameContainer& Container, NameLookup& Lookup, const NameInfo& Info);
+
 	/* Returns index of NameInfo inside of the NameContainer it was added to */
-	uint64 AddNameToContainer(NameContainer& StructNames, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct, UEFunction Func = nullptr);
+	uint64 AddNameToContainer(NameContainer& StructNames, NameLookup& StructLookup, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct, UEFunction Func = nullptr);
 
 public:
 	/* For external use by 'MemberManager::InitReservedNames()' */
@@ -141,8 +182,11 @@ public:
 	template<typename UEType>
 	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, UEType Member)
 	{
-		CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
-		uint64 NameInfoIndex = TranslationMap[KeyFunctions::GetKeyForCollisionInfo(Struct, Member)];
+		const CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
+
+		/* Read-only, called from multiple generator threads */
+		auto It = TranslationMap.find(KeyFunctions::GetKeyForCollisionInfo(Struct, Member));
+		const uint64 NameInfoIndex = It != TranslationMap.end() ? It->second : 0x0;
 
 		return InfosForStruct.at(NameInfoIndex);
 	}
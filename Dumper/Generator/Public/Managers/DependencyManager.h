@@ -5,6 +5,7 @@
 #include <iostream>
 #include <format>
 #include <functional>
+#include <vector>
 
 #include "Unreal/Enums.h"
 
@@ -17,17 +18,45 @@ public:
 private:
 	struct IndexDependencyInfo
 	{
-		/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-		mutable uint64 IterationHitCounter = 0x0;
+		/* Index of this element in the flattened graph, only valid while the graph is up to date */
+		mutable int32 LocalIndex = -1;
 
 		/* Indices of Objects required by this Object */
 		std::unordered_set<int32> DependencyIndices;
 	};
 
+	/*
+	* Flattened copy of AllDependencies in CSR-layout. Nodes are numbered in iteration-order of AllDependencies, the edges of
+	* node 'i' are Edges[EdgeBegin[i]] to Edges[EdgeBegin[i + 1]] in iteration-order of its DependencyIndices. Visiting nodes
+	* and edges in this order yields exactly the order the recursive visitor used to produce.
+	*/
+	struct FlatGraph
+	{
+		std::vector<int32> ObjectIndices;
+		std::vector<int32> EdgeBegin;
+		std::vector<int32> Edges;
+
+		/* Node was visited in the iteration with this number */
+		std::vector<uint64> VisitedInIteration;
+	};
+
+	struct VisitStackEntry
+	{
+		int32 LocalIndex;
+		int32 NextEdge;
+	};
+
 private:
 	/* List of Objects and their Dependencies */
 	std::unordered_map<int32, IndexDependencyInfo> AllDependencies;
 
+	/* Rebuilt on the first visit after AllDependencies was modified */
+	mutable FlatGraph Graph;
+	mutable bool bIsGraphOutdated = true;
+
+	/* Reused between visits, so visiting doesn't allocate once the stack has grown to the maximum depth */
+	mutable std::vector<VisitStackEntry> VisitStack;
+
 	/* Count to track how often the Dependency-List was iterated. Allows for up to 2^64 iterations of this list. */
 	mutable uint64 CurrentIterationHitCount = 0x0;
 
@@ -37,7 +66,41 @@ public:
 	DependencyManager(int32 ObjectToTrack);
 
 private:
-	void VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const;
+	void BuildGraphIfOutdated() const;
+
+	/* Iterative post-order DFS, calls 'Callback' for every dependency of a node before calling it for the node itself */
+	template<typename CallbackType>
+	inline void VisitLocalIndexAndDependencies(int32 StartIndex, CallbackType& Callback) const
+	{
+		if (Graph.VisitedInIteration[StartIndex] >= CurrentIterationHitCount)
+			return;
+
+		Graph.VisitedInIteration[StartIndex] = CurrentIterationHitCount;
+		VisitStack.push_back({ StartIndex, Graph.EdgeBegin[StartIndex] });
+
+		while (!VisitStack.empty())
+		{
+			VisitStackEntry& Top = VisitStack.back();
+
+			if (Top.NextEdge < Graph.EdgeBegin[Top.LocalIndex + 1])
+			{
+				const int32 Dependency = Graph.Edges[Top.NextEdge++];
+
+				if (Graph.VisitedInIteration[Dependency] >= CurrentIterationHitCount)
+					continue;
+
+				Graph.VisitedInIteration[Dependency] = CurrentIterationHitCount;
+				VisitStack.push_back({ Dependency, Graph.EdgeBegin[Dependency] });
+
+				continue;
+			}
+
+			const int32 ObjectIndex = Graph.ObjectIndices[Top.LocalIndex];
+			VisitStack.pop_back();
+
+			Callback(ObjectIndex);
+		}
+	}
 
 public:
 	void SetExists(const int32 DepedantIdx);
@@ -48,8 +111,28 @@ public:
 
 	size_t GetNumEntries() const;
 
-	void VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const;
-	void VisitAllNodesWithCallback(OnVisitCallbackType Callback) const;
+	template<typename CallbackType>
+	inline void VisitIndexAndDependenciesWithCallback(int32 Index, CallbackType&& Callback) const
+	{
+		BuildGraphIfOutdated();
+
+		CurrentIterationHitCount++;
+
+		VisitLocalIndexAndDependencies(AllDependencies.at(Index).LocalIndex, Callback);
+	}
+
+	template<typename CallbackType>
+	inline void VisitAllNodesWithCallback(CallbackType&& Callback) const
+	{
+		BuildGraphIfOutdated();
+
+		CurrentIterationHitCount++;
+
+		const int32 NumNodes = static_cast<int32>(Graph.ObjectIndices.size());
+
+		for (int32 i = 0; i < NumNodes; i++)
+			VisitLocalIndexAndDependencies(i, Callback);
+	}
 
 public:
 	const auto DEBUG_DependencyMap() const
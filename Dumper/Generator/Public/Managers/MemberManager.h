@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "ObjectArray.h"
+#include "ReflectionSnapshot.h"
 #include "HashStringTable.h"
 #include "CollisionManager.h"
 #include "PredefinedMembers.h"
@@ -297,12 +298,14 @@ public:
 		InitReservedNames();
 
 		/* Initialize member-name collisions  */
-		for (auto Obj : ObjectArray())
+		const ReflectionSnapshot::StructTable& Structs = ReflectionSnapshot::GetStructs();
+
+		for (int32 Slot = 0; Slot < Structs.Num(); Slot++)
 		{
-			if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
+			if (ReflectionSnapshot::IsA(Structs.ObjectIndex[Slot], EClassCastFlags::Function))
 				continue;
 
-			AddStructToNameContainer(Obj.Cast<UEStruct>());
+			AddStructToNameContainer(ReflectionSnapshot::GetObject<UEStruct>(Structs.ObjectIndex[Slot]));
 		}
 	}
 
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Managers/DependencyManager.h"
+
+/*
+* Benchmark of DependencyManager against the recursive std::function visitor its flattened graph replaced, on a synthetic graph.
+*
+* Usage: dependencymanager-bench [number-of-nodes = 100000] [number-of-visits = 10]
+*
+* Every node depends on up to 8 nodes added before it, mostly close ones, like structs depending on the structs of their own package.
+* Prints "D7BENCH <name> <milliseconds>" lines and exits non-zero if both visitors don't produce the same order.
+*/
+
+/* The visitor DependencyManager had before the flattened graph, one recursive call through std::function per node */
+class RecursiveDependencyManager
+{
+private:
+	struct IndexDependencyInfo
+	{
+		mutable uint64 IterationHitCounter = 0x0;
+		std::unordered_set<int32> DependencyIndices;
+	};
+
+private:
+	std::unordered_map<int32, IndexDependencyInfo> AllDependencies;
+	mutable uint64 CurrentIterationHitCount = 0x0;
+
+public:
+	void AddDependency(const int32 DepedantIdx, int32 DependencyIndex)
+	{
+		AllDependencies[DepedantIdx].DependencyIndices.insert(DependencyIndex);
+	}
+
+	void SetExists(const int32 DepedantIdx)
+	{
+		AllDependencies[DepedantIdx];
+	}
+
+private:
+	void VisitIndexAndDependencies(int32 Index, DependencyManager::OnVisitCallbackType Callback) const
+	{
+		auto& [IterationHitCounter, Dependencies] = AllDependencies.at(Index);
+
+		if (IterationHitCounter >= CurrentIterationHitCount)
+			return;
+
+		IterationHitCounter = CurrentIterationHitCount;
+
+		for (int32 Dependency : Dependencies)
+			VisitIndexAndDependencies(Dependency, Callback);
+
+		Callback(Index);
+	}
+
+public:
+	void VisitAllNodesWithCallback(DependencyManager::OnVisitCallbackType Callback) const
+	{
+		CurrentIterationHitCount++;
+
+		for (const auto& [Index, DependencyInfo] : AllDependencies)
+			VisitIndexAndDependencies(Index, Callback);
+	}
+};
+
+template<typename Callable>
+static double TimeMilliseconds(Callable&& Function)
+{
+	const auto Start = std::chrono::steady_clock::now();
+
+	Function();
+
+	const std::chrono::duration<double, std::milli> Duration = std::chrono::steady_clock::now() - Start;
+	return Duration.count();
+}
+
+int main(int argc, char** argv)
+{
+	const int32 NumNodes = argc > 1 ? static_cast<int32>(strtol(argv[1], nullptr, 10)) : 100000;
+	const int32 NumVisits = argc > 2 ? static_cast<int32>(strtol(argv[2], nullptr, 10)) : 10;
+
+	/* Sparse like GObjects indices of structs, which are spread over the whole object array */
+	auto ObjectIndex = [](int32 Node) -> int32 { return Node * 7 + 3; };
+
+	std::vector<std::pair<int32, int32>> Edges;
+
+	/* xorshift, deterministic between runs */
+	uint64_t State = 0x9E3779B97F4A7C15ull;
+	auto Next = [&]() -> uint64_t
+	{
+		State ^= State << 13;
+		State ^= State >> 7;
+		State ^= State << 17;
+		return State;
+	};
+
+	for (int32 i = 1; i < NumNodes; i++)
+	{
+		const int32 NumDependencies = static_cast<int32>(Next() % 9);
+
+		for (int32 j = 0; j < NumDependencies; j++)
+		{
+			/* One in sixteen dependencies goes anywhere, the others to one of the 256 nodes added just before */
+			const int32 Distance = (Next() & 0xF) == 0 ? static_cast<int32>(Next() % i) + 1 : static_cast<int32>(Next() % std::min(i, 256)) + 1;
+
+			Edges.emplace_back(ObjectIndex(i), ObjectIndex(i - Distance));
+		}
+	}
+
+	RecursiveDependencyManager RecursiveManager;
+	DependencyManager FlatManager;
+
+	const double RecursiveAddMs = TimeMilliseconds([&]()
+	{
+		for (int32 i = 0; i < NumNodes; i++)
+			RecursiveManager.SetExists(ObjectIndex(i));
+
+		for (const auto& [Dependant, Dependency] : Edges)
+			RecursiveManager.AddDependency(Dependant, Dependency);
+	});
+
+	const double FlatAddMs = TimeMilliseconds([&]()
+	{
+		for (int32 i = 0; i < NumNodes; i++)
+			FlatManager.SetExists(ObjectIndex(i));
+
+		for (const auto& [Dependant, Dependency] : Edges)
+			FlatManager.AddDependency(Dependant, Dependency);
+	});
+
+	std::vector<int32> RecursiveOrder;
+	std::vector<int32> FlatOrder;
+	RecursiveOrder.reserve(NumNodes);
+	FlatOrder.reserve(NumNodes);
+
+	int NumMismatches = 0;
+
+	const double RecursiveVisitMs = TimeMilliseconds([&]()
+	{
+		for (int32 i = 0; i < NumVisits; i++)
+		{
+			RecursiveOrder.clear();
+			RecursiveManager.VisitAllNodesWithCallback([&](int32 Index) { RecursiveOrder.push_back(Index); });
+		}
+	});
+
+	/* Includes flattening the graph on the first visit */
+	const double FlatVisitMs = TimeMilliseconds([&]()
+	{
+		for (int32 i = 0; i < NumVisits; i++)
+		{
+			FlatOrder.clear();
+			FlatManager.VisitAllNodesWithCallback([&](int32 Index) { FlatOrder.push_back(Index); });
+		}
+	});
+
+	if (RecursiveOrder != FlatOrder)
+	{
+		fprintf(stderr, "Visit order differs, %zu (recursive) and %zu (flat) nodes visited\n", RecursiveOrder.size(), FlatOrder.size());
+		NumMismatches++;
+	}
+
+	printf("D7BENCH RecursiveAdd %.3f\n", RecursiveAddMs);
+	printf("D7BENCH DependencyManagerAdd %.3f\n", FlatAddMs);
+	printf("D7BENCH RecursiveVisit %.3f\n", RecursiveVisitMs);
+	printf("D7BENCH DependencyManagerVisit %.3f\n", FlatVisitMs);
+	printf("%d nodes, %zu edges, %d visits, %.2fx visit speedup\n", NumNodes, Edges.size(), NumVisits, RecursiveVisitMs / FlatVisitMs);
+
+	return NumMismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "HashStringTable.h"
+
+/*
+* Benchmark of HashStringTable against the per-bucket linear scan its lookup-index replaced, on synthetic object names.
+*
+* Usage: hashstringtable-bench [number-of-names = 500000]
+*
+* Every name is added once (with a share of duplicates, like the colliding names of a real SDK) and then looked up again.
+* Prints "D7BENCH <name> <milliseconds>" lines and exits non-zero if both tables don't agree on which names were added.
+*/
+
+/* The table HashStringTable was before the lookup-index: 32 packed buckets, a lookup walks every entry of the bucket */
+class LinearScanStringTable
+{
+private:
+	std::vector<char> Buckets[MaxHashNumber];
+
+public:
+	/* returns bWasAdded */
+	bool FindOrAdd(const std::string& String)
+	{
+		std::vector<char>& Bucket = Buckets[SmallPearsonHash(String.c_str())];
+
+		const uint16 Length = static_cast<uint16>(String.size());
+
+		for (size_t Offset = 0; Offset < Bucket.size();)
+		{
+			uint16 EntryLength;
+			memcpy(&EntryLength, Bucket.data() + Offset, sizeof(EntryLength));
+
+			if (EntryLength == Length && memcmp(Bucket.data() + Offset + sizeof(EntryLength), String.data(), Length) == 0)
+				return false;
+
+			Offset += sizeof(EntryLength) + EntryLength;
+		}
+
+		const size_t Offset = Bucket.size();
+		Bucket.resize(Offset + sizeof(Length) + Length);
+
+		memcpy(Bucket.data() + Offset, &Length, sizeof(Length));
+		memcpy(Bucket.data() + Offset + sizeof(Length), String.data(), Length);
+
+		return true;
+	}
+};
+
+template<typename Callable>
+static double TimeMilliseconds(Callable&& Function)
+{
+	const auto Start = std::chrono::steady_clock::now();
+
+	Function();
+
+	const std::chrono::duration<double, std::milli> Duration = std::chrono::steady_clock::now() - Start;
+	return Duration.count();
+}
+
+int main(int argc, char** argv)
+{
+	const size_t NumNames = argc > 1 ? strtoull(argv[1], nullptr, 10) : 500000;
+
+	const std::vector<const char*> Prefixes = {
+		"BP_", "WBP_", "ABP_", "F", "U", "E", "GA_", "GE_", "DA_", "ST_",
+	};
+
+	const std::vector<const char*> Words = {
+		"Weapon", "Character", "Ability", "Inventory", "Widget", "Vehicle", "Projectile", "Pickup", "Component", "Controller",
+		"Attribute", "Montage", "Effect", "Settings", "Manager", "Spawner", "Volume", "Trigger", "Animation", "Button",
+	};
+
+	std::vector<std::string> Names;
+	Names.reserve(NumNames);
+
+	/* xorshift, deterministic between runs */
+	uint64_t State = 0x9E3779B97F4A7C15ull;
+	auto Next = [&]() -> uint64_t
+	{
+		State ^= State << 13;
+		State ^= State >> 7;
+		State ^= State << 17;
+		return State;
+	};
+
+	for (size_t i = 0; i < NumNames; i++)
+	{
+		/* Every 8th name repeats an earlier one */
+		if (i > 0 && (Next() & 0x7) == 0)
+		{
+			Names.push_back(Names[Next() % Names.size()]);
+			continue;
+		}
+
+		std::string Name = Prefixes[Next() % Prefixes.size()];
+		Name += Words[Next() % Words.size()];
+		Name += '_';
+		Name += Words[Next() % Words.size()];
+		Name += '_';
+		Name += std::to_string(i);
+
+		Names.push_back(std::move(Name));
+	}
+
+	LinearScanStringTable LinearTable;
+	HashStringTable IndexedTable;
+
+	std::vector<bool> LinearAdded(NumNames);
+	std::vector<bool> IndexedAdded(NumNames);
+
+	const double LinearInsertMs = TimeMilliseconds([&]()
+	{
+		for (size_t i = 0; i < NumNames; i++)
+			LinearAdded[i] = LinearTable.FindOrAdd(Names[i]);
+	});
+
+	const double IndexedInsertMs = TimeMilliseconds([&]()
+	{
+		for (size_t i = 0; i < NumNames; i++)
+			IndexedAdded[i] = IndexedTable.FindOrAdd(Names[i]).second;
+	});
+
+	size_t NumLinearFound = 0;
+	size_t NumIndexedFound = 0;
+
+	const double LinearLookupMs = TimeMilliseconds([&]()
+	{
+		for (size_t i = 0; i < NumNames; i++)
+			NumLinearFound += !LinearTable.FindOrAdd(Names[i]);
+	});
+
+	const double IndexedLookupMs = TimeMilliseconds([&]()
+	{
+		for (size_t i = 0; i < NumNames; i++)
+			NumIndexedFound += !IndexedTable.FindOrAdd(Names[i], false).second;
+	});
+
+	int NumMismatches = 0;
+
+	for (size_t i = 0; i < NumNames; i++)
+	{
+		if (LinearAdded[i] != IndexedAdded[i])
+		{
+			if (NumMismatches++ < 10)
+				fprintf(stderr, "Name %zu '%s': linear %s, indexed %s\n", i, Names[i].c_str(), LinearAdded[i] ? "added" : "found", IndexedAdded[i] ? "added" : "found");
+		}
+	}
+
+	if (NumLinearFound != NumNames || NumIndexedFound != NumNames)
+	{
+		fprintf(stderr, "Lookups found %zu (linear) and %zu (indexed) of %zu names\n", NumLinearFound, NumIndexedFound, NumNames);
+		NumMismatches++;
+	}
+
+	printf("D7BENCH LinearScanInsert %.3f\n", LinearInsertMs);
+	printf("D7BENCH HashStringTableInsert %.3f\n", IndexedInsertMs);
+	printf("D7BENCH LinearScanLookup %.3f\n", LinearLookupMs);
+	printf("D7BENCH HashStringTableLookup %.3f\n", IndexedLookupMs);
+	printf("%zu names, %.2fx insert speedup, %.2fx lookup speedup\n", NumNames, LinearInsertMs / IndexedInsertMs, LinearLookupMs / IndexedLookupMs);
+
+	return NumMismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+#include <cstdio>
+#include <cstdarg>
+#include <mutex>
+
+#include "Menu/Logger.h"
+
+/* Console-less implementation of Menu/Logger.h for host builds, everything goes to stdout, errors to stderr */
+
+static std::mutex LogLock;
+
+static void LogToStream(ELogLevel Level, const char* Fmt, va_list Args)
+{
+	FILE* Stream = Level == ELogLevel::Error ? stderr : stdout;
+
+	std::scoped_lock Lock(LogLock);
+
+	vfprintf(Stream, Fmt, Args);
+	fputc('\n', Stream);
+}
+
+void LogMessage(ELogLevel Level, const char* Fmt, ...)
+{
+	if (static_cast<int>(Level) < DUMPER_MIN_LOG_LEVEL)
+		return;
+
+	va_list Args;
+	va_start(Args, Fmt);
+	LogToStream(Level, Fmt, Args);
+	va_end(Args);
+}
+
+void (LogInfo)(const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	LogToStream(ELogLevel::Info, Fmt, Args);
+	va_end(Args);
+}
+
+void (LogError)(const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	LogToStream(ELogLevel::Error, Fmt, Args);
+	va_end(Args);
+}
+
+void (LogSuccess)(const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	LogToStream(ELogLevel::Success, Fmt, Args);
+	va_end(Args);
+}
@@ -0,0 +1,93 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Generators/CppGenerator.h"
+#include "Generators/MappingGenerator.h"
+#include "Generators/IDAMappingGenerator.h"
+#include "Generators/DumpspaceGenerator.h"
+
+#include "Generators/Generator.h"
+
+#include "Unreal/ObjectArray.h"
+#include "Menu/Logger.h"
+
+/*
+* Offline entry point, runs the whole pipeline on a process snapshot written on device with Settings::Debug::bWriteProcessSnapshot.
+*
+* Usage: dumper-host <snapshot.d7snap> [output-dir] [game-name] [game-version]
+*
+* Every phase prints one "D7BENCH <phase> <milliseconds>" line to stdout, CI jobs diff those against a previous run to catch slowdowns.
+* The exit code is non-zero if the snapshot could not be loaded or no objects were found in it.
+*/
+
+struct PhaseTiming
+{
+	const char* Name;
+	double Milliseconds;
+};
+
+static std::vector<PhaseTiming> Timings;
+
+template<typename Callable>
+static void RunPhase(const char* Name, Callable&& Phase)
+{
+	const auto Start = std::chrono::steady_clock::now();
+
+	Phase();
+
+	const std::chrono::duration<double, std::milli> Duration = std::chrono::steady_clock::now() - Start;
+
+	Timings.push_back({ Name, Duration.count() });
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage: %s <snapshot.d7snap> [output-dir] [game-name] [game-version]\n", argv[0]);
+		return 2;
+	}
+
+	/* The generators write to <SDKGenerationPath>/Documents/<GameVersion>-<GameName> */
+	Settings::Generator::SDKGenerationPath = argc > 2 ? argv[2] : ".";
+	Settings::Generator::GameName = argc > 3 ? argv[3] : "Snapshot";
+	Settings::Generator::GameVersion = argc > 4 ? argv[4] : "Host";
+
+	bool bLoadedSnapshot = false;
+	RunPhase("LoadSnapshot", [&]() { bLoadedSnapshot = Memory::LoadSnapshot(argv[1]); });
+
+	if (!bLoadedSnapshot)
+	{
+		LogError("Could not load the process snapshot '%s'", argv[1]);
+		return 1;
+	}
+
+	RunPhase("InitEngineCore", []() { Generator::InitEngineCore(); });
+
+	if (ObjectArray::Num() <= 0)
+	{
+		LogError("No objects were found in the process snapshot");
+		return 1;
+	}
+
+	RunPhase("InitInternal", []() { Generator::InitInternal(); });
+
+	RunPhase("CppGenerator", []() { Generator::Generate<CppGenerator>(); });
+	RunPhase("MappingGenerator", []() { Generator::Generate<MappingGenerator>(); });
+	RunPhase("IDAMappingGenerator", []() { Generator::Generate<IDAMappingGenerator>(); });
+	RunPhase("DumpspaceGenerator", []() { Generator::Generate<DumpspaceGenerator>(); });
+
+	double TotalMilliseconds = 0.0;
+
+	for (const PhaseTiming& Timing : Timings)
+	{
+		printf("D7BENCH %s %.3f\n", Timing.Name, Timing.Milliseconds);
+		TotalMilliseconds += Timing.Milliseconds;
+	}
+
+	printf("D7BENCH Total %.3f\n", TotalMilliseconds);
+
+	return 0;
+}
@@ -0,0 +1,198 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "Memory/PatternScanner.h"
+#include "Memory/MemoryReader.h"
+
+/*
+* Benchmark of PatternScanner against the per-signature scalar scan it replaced, on a synthetic buffer.
+*
+* Usage: scanner-bench [buffer-size-in-MiB = 200]
+*
+* Every signature is planted once near the end of the buffer, so the scalar scan has to sweep (almost) the whole buffer per signature.
+* Prints "D7BENCH <name> <milliseconds>" lines and exits non-zero if both scans don't agree on every hit.
+*/
+
+/* Reports a single heap buffer as the only readable memory, PatternScanner walks regions through the reader */
+class BufferMemoryReader : public MemoryReader
+{
+private:
+	MemoryRegion Buffer;
+	std::vector<MemoryImage> NoImages;
+
+public:
+	BufferMemoryReader(const uint8_t* Data, size_t Size)
+		: Buffer{ reinterpret_cast<uintptr_t>(Data), Size, 1 /* VM_PROT_READ */ }
+	{
+	}
+
+public:
+	bool Read(uintptr_t Address, void* OutBuffer, size_t Size) const override
+	{
+		if (!Buffer.Contains(Address) || Address + Size > Buffer.End())
+			return false;
+
+		memcpy(OutBuffer, reinterpret_cast<const void*>(Address), Size);
+		return true;
+	}
+
+	bool QueryRegion(uintptr_t Address, MemoryRegion& OutRegion) const override
+	{
+		if (Address >= Buffer.End())
+			return false;
+
+		OutRegion = Buffer;
+		return true;
+	}
+
+	const std::vector<MemoryImage>& GetImages() const override { return NoImages; }
+	bool IsLive() const override { return false; }
+};
+
+/* The scan FindPatternInRange did before PatternScanner, -1 is a wildcard */
+static const uint8_t* ScalarFindPattern(const std::vector<int>& Signature, const uint8_t* Start, uintptr_t Range)
+{
+	const size_t PatternLength = Signature.size();
+	const uint8_t* End = Start + Range;
+
+	for (const uint8_t* Curr = Start; Curr <= (End - PatternLength); ++Curr)
+	{
+		bool bFound = true;
+
+		for (size_t j = 0; j < PatternLength; ++j)
+		{
+			if (Curr[j] != Signature[j] && Signature[j] != -1)
+			{
+				bFound = false;
+				break;
+			}
+		}
+
+		if (bFound)
+			return Curr;
+	}
+
+	return nullptr;
+}
+
+static std::vector<int> SignatureToBytes(const char* Signature)
+{
+	std::vector<int> Bytes;
+
+	for (const char* Curr = Signature; *Curr; Curr++)
+	{
+		if (*Curr == ' ')
+			continue;
+
+		if (*Curr == '?')
+		{
+			if (Curr[1] == '?')
+				Curr++;
+
+			Bytes.push_back(-1);
+			continue;
+		}
+
+		Bytes.push_back(static_cast<int>(strtoul(Curr, const_cast<char**>(&Curr), 16)));
+		Curr--;
+	}
+
+	return Bytes;
+}
+
+template<typename Callable>
+static double TimeMilliseconds(Callable&& Function)
+{
+	const auto Start = std::chrono::steady_clock::now();
+
+	Function();
+
+	const std::chrono::duration<double, std::milli> Duration = std::chrono::steady_clock::now() - Start;
+	return Duration.count();
+}
+
+int main(int argc, char** argv)
+{
+	const size_t BufferSize = (argc > 1 ? strtoull(argv[1], nullptr, 10) : 200) * 1024 * 1024;
+
+	/* ARM64 prologues and call sequences, like the AppendString/ToString/ProcessEvent signatures */
+	const std::vector<const char*> Signatures = {
+		"FF 43 01 D1 F6 57 02 A9 F4 4F 03 A9 FD 7B 04 A9",
+		"FD 7B BF A9 FD 03 00 91 ? ? ? 94 FD 7B C1 A8",
+		"F4 4F BE A9 FD 7B 01 A9 FD 43 00 91 F3 03 01 AA",
+		"? ? ? 90 08 ? ? F9 08 01 40 F9 1F 01 00 EB",
+		"E0 03 13 AA ? ? ? 97 E0 03 14 AA ? ? ? 97",
+		"08 0C 40 B9 1F 05 00 71 ? ? 00 54 08 10 40 F9",
+		"FF C3 00 D1 F4 4F 01 A9 FD 7B 02 A9 FD 83 00 91 F3 03 00 AA",
+		"C0 03 5F D6 1F 20 03 D5 1F 20 03 D5 FD 7B BF A9",
+	};
+
+	std::unique_ptr<uint8_t[]> Buffer(new uint8_t[BufferSize]);
+
+	/* xorshift filler, deterministic between runs */
+	uint64_t State = 0x9E3779B97F4A7C15ull;
+	for (size_t i = 0; i < BufferSize; i += sizeof(uint64_t))
+	{
+		State ^= State << 13;
+		State ^= State >> 7;
+		State ^= State << 17;
+		memcpy(Buffer.get() + i, &State, std::min(sizeof(uint64_t), BufferSize - i));
+	}
+
+	std::vector<std::vector<int>> ByteSignatures;
+
+	for (size_t i = 0; i < Signatures.size(); i++)
+	{
+		ByteSignatures.push_back(SignatureToBytes(Signatures[i]));
+
+		uint8_t* PlantAt = Buffer.get() + BufferSize - (Signatures.size() - i) * 0x1000;
+
+		for (size_t j = 0; j < ByteSignatures[i].size(); j++)
+		{
+			if (ByteSignatures[i][j] != -1)
+				PlantAt[j] = static_cast<uint8_t>(ByteSignatures[i][j]);
+		}
+	}
+
+	Memory::SetReader(std::make_unique<BufferMemoryReader>(Buffer.get(), BufferSize));
+
+	std::vector<const uint8_t*> ScalarHits(Signatures.size());
+
+	const double ScalarMs = TimeMilliseconds([&]()
+	{
+		for (size_t i = 0; i < Signatures.size(); i++)
+			ScalarHits[i] = ScalarFindPattern(ByteSignatures[i], Buffer.get(), BufferSize);
+	});
+
+	std::vector<std::vector<uintptr_t>> ScannerHits;
+
+	const double ScannerMs = TimeMilliseconds([&]()
+	{
+		const PatternScanner Scanner(Signatures);
+		ScannerHits = Scanner.Scan(Buffer.get(), BufferSize, 1);
+	});
+
+	int NumMismatches = 0;
+
+	for (size_t i = 0; i < Signatures.size(); i++)
+	{
+		const uintptr_t Expected = reinterpret_cast<uintptr_t>(ScalarHits[i]);
+		const uintptr_t Found = ScannerHits[i].empty() ? 0x0 : ScannerHits[i].front();
+
+		if (Expected != Found)
+		{
+			fprintf(stderr, "Signature %zu: scalar 0x%llX, scanner 0x%llX\n", i, static_cast<unsigned long long>(Expected), static_cast<unsigned long long>(Found));
+			NumMismatches++;
+		}
+	}
+
+	printf("D7BENCH ScalarScan %.3f\n", ScalarMs);
+	printf("D7BENCH PatternScanner %.3f\n", ScannerMs);
+	printf("%zu signatures over %zu MiB, %.2fx speedup\n", Signatures.size(), BufferSize / (1024 * 1024), ScalarMs / ScannerMs);
+
+	return NumMismatches == 0 ? 0 : 1;
+}
@@ -1,29 +1,76 @@
 #pragma once
-#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <ctime>
+#include <deque>
 #include <string>
-#include <mutex>
 #include "../ImGui/imgui.h"
+#include "Logger.h"
 
-// Define Log Types
-struct Output {
+// One preformatted log message, slot of the LogRingBuffer
+struct LogRecord {
+    static constexpr size_t kMaxTextSize = 1024;
+
+    std::atomic<uint64_t> sequence{0}; // sequence number + 1 once published, 0 while a writer fills the slot
+    time_t time;                       // Formatted only when the line is drawn
+    ELogLevel level;
+    uint16_t length;
+    char text[kMaxTextSize];
+};
+
+// Fixed-capacity multi-producer single-consumer ring of log records.
+// Writers never wait: a slot is claimed with one atomic increment and the oldest record is overwritten once the ring is full.
+// The consumer validates every slot it copies against the slot's sequence number, so it never blocks writers either.
+class LogRingBuffer {
+public:
+    static constexpr uint64_t kCapacity = 2048; // Power of two
+
+    void push(ELogLevel level, const char* text, size_t length);
+
+    // Hands every record published since 'nextSequence' to 'onRecord', oldest first, and advances 'nextSequence'.
+    // Returns the number of records that were overwritten before they could be read.
+    template<typename Fn>
+    uint64_t drain(uint64_t& nextSequence, Fn&& onRecord);
+
+private:
+    std::atomic<uint64_t> head{0};
+    LogRecord records[kCapacity];
+};
+
+// A single line as displayed, records containing '\n' are split into several lines
+struct ConsoleLine {
     std::string text;
-    std::string time;
-    int type; // 0=Log, 1=Error, 2=Success
+    time_t time; // 0 for continuation lines of a multi-line record
+    ELogLevel level;
 };
 
 class Console {
 public:
+    static constexpr size_t kMaxLines = 20000;
+
     static Console& Get(); // Singleton accessor
 
-    std::vector<Output> outputArr;
-    std::mutex logMutex;
     bool autoScroll = true;
     bool visible = true;
 
-    void log(const std::string& text);
-    void logError(const std::string& text);
-    void logInfo(const std::string& text); // Using for Success/Highlight
+    void push(ELogLevel level, const char* text, size_t length); // Any thread
     void clearLogs();
-    
+    void copyToClipboard();
+
     void Render(); // Call this in your ImGui loop
+
+private:
+    void pullNewRecords();
+    const char* formatTime(time_t time);
+
+    LogRingBuffer ring;
+
+    // Only touched by the UI thread
+    uint64_t nextSequence = 0;
+    uint64_t numDropped = 0;
+    std::deque<ConsoleLine> lines;
+
+    time_t formattedTime = 0;
+    char formattedTimeStr[16] = {}; // "[HH:MM:SS] "
 };
@@ -1,5 +1,6 @@
 #include "Console.h"
-#include <ctime>
+#include <algorithm>
+#include <cstring>
 #include <cstdio>
 
 Console& Console::Get() {
@@ -7,42 +8,145 @@ Console& Console::Get() {
     return instance;
 }
 
-// Helper for time string
-static std::string GetTimeStr() {
-    time_t now = time(0);
-    struct tm tstruct;
-    char buf[80];
-    tstruct = *localtime(&now);
-    strftime(buf, sizeof(buf), "%H:%M:%S", &tstruct);
-    return std::string(buf);
+void LogRingBuffer::push(ELogLevel level, const char* text, size_t length) {
+    const uint64_t sequence = head.fetch_add(1, std::memory_order_relaxed);
+    LogRecord& record = records[sequence & (kCapacity - 1)];
+
+    // Readers seeing 0 know the slot is being rewritten
+    record.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    length = std::min(length, LogRecord::kMaxTextSize);
+
+    record.time = time(nullptr);
+    record.level = level;
+    record.length = static_cast<uint16_t>(length);
+    memcpy(record.text, text, length);
+
+    record.sequence.store(sequence + 1, std::memory_order_release);
 }
 
-void Console::log(const std::string& text) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    outputArr.push_back({ text, GetTimeStr(), 0 });
+template<typename Fn>
+uint64_t LogRingBuffer::drain(uint64_t& nextSequence, Fn&& onRecord) {
+    const uint64_t end = head.load(std::memory_order_acquire);
+    uint64_t numDropped = 0;
+
+    if (end - nextSequence > kCapacity) {
+        numDropped += (end - kCapacity) - nextSequence;
+        nextSequence = end - kCapacity;
+    }
+
+    LogRecord copy;
+
+    for (; nextSequence < end; nextSequence++) {
+        const LogRecord& record = records[nextSequence & (kCapacity - 1)];
+
+        const uint64_t before = record.sequence.load(std::memory_order_acquire);
+
+        // Claimed but not yet published, picked up on the next frame
+        if (before < nextSequence + 1)
+            break;
+
+        // Already overwritten by a newer record
+        if (before != nextSequence + 1) {
+            numDropped++;
+            continue;
+        }
+
+        copy.time = record.time;
+        copy.level = record.level;
+        copy.length = std::min<uint16_t>(record.length, LogRecord::kMaxTextSize);
+        memcpy(copy.text, record.text, copy.length);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // A writer lapped us while copying
+        if (record.sequence.load(std::memory_order_relaxed) != before) {
+            numDropped++;
+            continue;
+        }
+
+        onRecord(copy);
+    }
+
+    return numDropped;
 }
 
-void Console::logError(const std::string& text) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    outputArr.push_back({ text, GetTimeStr(), 1 });
+void Console::push(ELogLevel level, const char* text, size_t length) {
+    ring.push(level, text, length);
 }
 
-void Console::logInfo(const std::string& text) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    outputArr.push_back({ text, GetTimeStr(), 2 });
+void Console::pullNewRecords() {
+    numDropped += ring.drain(nextSequence, [this](const LogRecord& record) {
+        const char* text = record.text;
+        const char* textEnd = record.text + record.length;
+        time_t time = record.time;
+
+        // One ConsoleLine per '\n'-separated part, ImGuiListClipper needs lines of equal height
+        while (true) {
+            const char* lineEnd = std::find(text, textEnd, '\n');
+
+            lines.push_back({ std::string(text, lineEnd), time, record.level });
+            time = 0;
+
+            if (lineEnd == textEnd)
+                break;
+
+            text = lineEnd + 1;
+        }
+    });
+
+    while (lines.size() > kMaxLines)
+        lines.pop_front();
+}
+
+const char* Console::formatTime(time_t time) {
+    // Consecutive lines mostly share the same second
+    if (time != formattedTime) {
+        struct tm tstruct;
+        localtime_r(&time, &tstruct);
+        strftime(formattedTimeStr, sizeof(formattedTimeStr), "[%H:%M:%S] ", &tstruct);
+        formattedTime = time;
+    }
+
+    return formattedTimeStr;
 }
 
 void Console::clearLogs() {
-    std::lock_guard<std::mutex> lock(logMutex);
-    outputArr.clear();
+    pullNewRecords();
+    lines.clear();
+    numDropped = 0;
+}
+
+void Console::copyToClipboard() {
+    pullNewRecords();
+
+    std::string text;
+
+    for (const ConsoleLine& line : lines) {
+        if (line.time != 0)
+            text += formatTime(line.time);
+
+        text += line.text;
+        text += '\n';
+    }
+
+    ImGui::SetClipboardText(text.c_str());
 }
 
 void Console::Render() {
+    pullNewRecords();
+
     // Log controls: Clear and Auto-scroll
     if (ImGui::Button("Clear")) clearLogs();
     ImGui::SameLine();
-    // Assuming 'autoScroll' is a public member of Console
     ImGui::Checkbox("Auto-scroll", &autoScroll);
+
+    if (numDropped > 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%llu messages dropped)", static_cast<unsigned long long>(numDropped));
+    }
+
     ImGui::Separator();
 
     // Log display area (Scrolling Region)
@@ -50,42 +154,46 @@ void Console::Render() {
     // BeginChild creates the scrollable area, filling the remaining vertical space
     ImGui::BeginChild("ScrollingRegion", ImVec2(0, -footer_height_to_reserve), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    {
-        std::lock_guard<std::mutex> lock(logMutex);
-        
-        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighter spacing for log lines
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighter spacing for log lines
+
+    // Only the lines inside the visible region are submitted
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(lines.size()));
+
+    while (clipper.Step()) {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+            const ConsoleLine& line = lines[i];
 
-        for (const auto& output : outputArr)
-        {
-            // Determine Color based on integer type (0=Log, 1=Error, 2=Success)
-            ImVec4 color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f); // Default White
+            ImVec4 color = ImVec4(0.4f, 0.8f, 1.0f, 1.0f); // Blue/Cyan for Info
 
-            if (output.type == 1) { // Error
+            if (line.level == ELogLevel::Error) {
                 color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f); // Red
-            } else if (output.type == 2) { // Success
+            } else if (line.level == ELogLevel::Success) {
                 color = ImVec4(0.4f, 1.0f, 0.4f, 1.0f); // Green
-            } else { // Log/Info (Type 0)
-                color = ImVec4(0.4f, 0.8f, 1.0f, 1.0f); // Blue/Cyan
+            } else if (line.level == ELogLevel::Verbose) {
+                color = ImVec4(0.6f, 0.6f, 0.6f, 1.0f); // Gray
             }
 
             ImGui::PushStyleColor(ImGuiCol_Text, color);
 
-            // Format: [Time] Text (incorporating drawTime logic from previous fixes)
-            std::string line = output.text;
-            if (!output.time.empty()) {
-                line = "[" + output.time + "] " + line;
+            // Format: [Time] Text
+            if (line.time != 0) {
+                ImGui::TextUnformatted(formatTime(line.time));
+                ImGui::SameLine(0.0f, 0.0f);
             }
 
-            ImGui::TextUnformatted(line.c_str());
+            ImGui::TextUnformatted(line.text.data(), line.text.data() + line.text.size());
             ImGui::PopStyleColor();
         }
-        
-        ImGui::PopStyleVar();
-
-        // Auto-scroll logic
-        if (autoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
-            ImGui::SetScrollHereY(1.0f);
     }
-    
+
+    clipper.End();
+
+    ImGui::PopStyleVar();
+
+    // Auto-scroll logic
+    if (autoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+        ImGui::SetScrollHereY(1.0f);
+
     ImGui::EndChild();
 }
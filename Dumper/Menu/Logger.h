@@ -4,7 +4,39 @@
 
 #pragma once
 
-// Global logging functions - safe to call from any thread
+enum class ELogLevel : int {
+    Verbose = 0, // Per-candidate output of scans, only useful when debugging the dumper itself
+    Info = 1,
+    Success = 2, // Green text for success messages
+    Error = 3,
+};
+
+// Calls below this level are compiled out, including the evaluation of their arguments.
+// Verbose output is only kept in debug builds (Theos defines DEBUG for those).
+#ifndef DUMPER_MIN_LOG_LEVEL
+#ifdef DEBUG
+#define DUMPER_MIN_LOG_LEVEL 0
+#else
+#define DUMPER_MIN_LOG_LEVEL 1
+#endif
+#endif
+
+// Global logging functions - safe to call from any thread, never block on the UI
+void LogMessage(ELogLevel level, const char* fmt, ...);
 void LogInfo(const char* fmt, ...);
 void LogError(const char* fmt, ...);
 void LogSuccess(const char* fmt, ...); // Green text for success messages
+
+#if DUMPER_MIN_LOG_LEVEL <= 0
+#define LogVerbose(...) LogMessage(ELogLevel::Verbose, __VA_ARGS__)
+#else
+#define LogVerbose(...) ((void)0)
+#endif
+
+#if DUMPER_MIN_LOG_LEVEL > 1
+#define LogInfo(...) ((void)0)
+#endif
+
+#if DUMPER_MIN_LOG_LEVEL > 2
+#define LogSuccess(...) ((void)0)
+#endif
@@ -9,42 +9,50 @@
 #include "Console.h" // Your Console class
 #include <cstdarg>
 #include <cstdio>
-#include <string>
-
-// Helper to format string and send to console
-static void LogToConsole(int type, const char* fmt, va_list args) {
-    char buffer[2048];
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
-    std::string msg(buffer);
-
-    // Assuming Console follows Singleton pattern or global instance
-    // Type 0 = Info/Default, 1 = Error, 2 = Success/Special
-    if (type == 1) {
-        Console::Get().logError(msg);
-    } else if (type == 2) {
-        Console::Get().logInfo(msg); // Reusing logInfo for "Success" style if available, or just log
-    } else {
-        Console::Get().log(msg);
-    }
+
+// Formats straight into a record-sized buffer, the console copies it into its ring buffer without taking a lock
+static void LogToConsole(ELogLevel level, const char* fmt, va_list args) {
+    char buffer[LogRecord::kMaxTextSize];
+    int length = vsnprintf(buffer, sizeof(buffer), fmt, args);
+
+    if (length < 0)
+        return;
+
+    // Truncated messages keep what fit into the buffer
+    if (static_cast<size_t>(length) >= sizeof(buffer))
+        length = sizeof(buffer) - 1;
+
+    Console::Get().push(level, buffer, static_cast<size_t>(length));
+}
+
+void LogMessage(ELogLevel level, const char* fmt, ...) {
+    if (static_cast<int>(level) < DUMPER_MIN_LOG_LEVEL)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+    LogToConsole(level, fmt, args);
+    va_end(args);
 }
 
-void LogInfo(const char* fmt, ...) {
+// Parenthesized names keep the definitions intact when Logger.h compiles the calls out
+void (LogInfo)(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    LogToConsole(0, fmt, args);
+    LogToConsole(ELogLevel::Info, fmt, args);
     va_end(args);
 }
 
-void LogError(const char* fmt, ...) {
+void (LogError)(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    LogToConsole(1, fmt, args);
+    LogToConsole(ELogLevel::Error, fmt, args);
     va_end(args);
 }
 
-void LogSuccess(const char* fmt, ...) {
+void (LogSuccess)(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    LogToConsole(2, fmt, args);
+    LogToConsole(ELogLevel::Success, fmt, args);
     va_end(args);
 }
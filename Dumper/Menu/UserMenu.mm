@@ -34,7 +34,8 @@ void UserMenu::RenderMenu()
         }
         ImGui::SameLine();
         if (ImGui::Button("Copy to Clipboard")) {
-            ImGui::LogToClipboard();
+            // The console only draws visible lines, ImGui::LogToClipboard() would miss the rest
+            Console::Get().copyToClipboard();
         }
         
         ImGui::Separator();
@@ -51,6 +51,12 @@ namespace Settings
 		inline std::string GameVersion = "";
 
         inline const char* SDKGenerationPath = getenv("HOME");
+
+		/* Dump the live process -> ProcessSnapshotPath = nullptr. Otherwise the engine core is read from a snapshot written with Settings::Debug::bWriteProcessSnapshot */
+		inline const char* ProcessSnapshotPath = nullptr;
+
+		/* Reuse the offsets of the last run on the same build of the game (matched by LC_UUID), skipping all scans in InitEngineCore */
+		inline bool bUseOffsetCache = true;
 	}
 
 	namespace CppGenerator
@@ -89,6 +95,12 @@ R"(
 
 		/* This will allow the user to manually initialize global variable addresses in the SDK (eg. GObjects, GNames, AppendString). */
 		constexpr bool bAddManualOverrideOptions = true;
+
+		/* Resolves UObject::FindObject/FindObjectFast, StaticClass() and function lookups in the SDK through an index of GObjects keyed by name, instead of walking all objects on every call */
+		constexpr bool bAddObjectLookupIndex = true;
+
+		/* Default of SDK_PREWARM_FUNCTION_TABLES in the generated Basic.hpp, which builds the function table of every class on a background thread once GObjects is initialized in the SDK */
+		constexpr bool bPrewarmFunctionTables = false;
 	}
 
 	namespace MappingGenerator
@@ -101,6 +113,18 @@ R"(
 
 		/* Which compression method to use when generating the file. */
 		constexpr EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::ZStandard;
+
+		/* ZStandard compression level (1 - 22). Levels above 19 use a lot more memory for a slightly smaller file. */
+		constexpr int32 ZStandardCompressionLevel = 19;
+
+		/* Number of worker threads used for ZStandard compression. Compress on the generator thread -> NumCompressionWorkers = 0 */
+		constexpr int32 NumCompressionWorkers = 4;
+	}
+
+	namespace IDAMappingGenerator
+	{
+		/* Additionally writes a '.idmapidx' file, a fixed-size offset table followed by a string blob, which import_idmap.py can mmap instead of parsing the '.idmap' */
+		constexpr bool bGenerateBinaryIndex = false;
 	}
 
 	/* Partially implemented  */
@@ -117,6 +141,15 @@ R"(
 
 		/* Prints debug information during Mapping-Generation */
 		inline constexpr bool bShouldPrintMappingDebugData = false;
+
+		/* Writes 'ProcessSnapshot.d7snap' to the Documents folder after the engine core was initialized, to re-run the generator offline */
+		inline constexpr bool bWriteProcessSnapshot = false;
+
+		/* Logs the number of bytes and flushes for every generated file when it is closed */
+		inline constexpr bool bLogFileWriterStats = false;
+
+		/* Generates all packages a second time on a single thread and checks that the files written by the package-workers are byte-for-byte identical */
+		inline constexpr bool bVerifyParallelPackageGeneration = false;
 	}
 
 	//* * * * * * * * * * * * * * * * * * * * *// 
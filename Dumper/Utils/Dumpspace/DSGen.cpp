@@ -2,6 +2,67 @@
 
 #include <fstream>
 
+static constexpr auto dumpspaceVersion = 10202;
+
+// same acceptance rules as the UTF-8 decoder of nlohmann::json (no overlongs, no surrogates, nothing above U+10FFFF)
+static bool isValidUtf8(const std::string& str)
+{
+	const auto* bytes = reinterpret_cast<const unsigned char*>(str.data());
+	const size_t length = str.length();
+
+	for (size_t i = 0; i < length;)
+	{
+		const unsigned char c = bytes[i];
+
+		if (c < 0x80)
+		{
+			i++;
+			continue;
+		}
+
+		size_t numContinuation = 0;
+		unsigned char minSecond = 0x80;
+		unsigned char maxSecond = 0xBF;
+
+		if (c >= 0xC2 && c <= 0xDF)
+		{
+			numContinuation = 1;
+		}
+		else if (c >= 0xE0 && c <= 0xEF)
+		{
+			numContinuation = 2;
+			minSecond = c == 0xE0 ? 0xA0 : 0x80;
+			maxSecond = c == 0xED ? 0x9F : 0xBF;
+		}
+		else if (c >= 0xF0 && c <= 0xF4)
+		{
+			numContinuation = 3;
+			minSecond = c == 0xF0 ? 0x90 : 0x80;
+			maxSecond = c == 0xF4 ? 0x8F : 0xBF;
+		}
+		else
+		{
+			return false;
+		}
+
+		if (i + numContinuation >= length)
+			return false;
+
+		if (bytes[i + 1] < minSecond || bytes[i + 1] > maxSecond)
+			return false;
+
+		for (size_t j = 2; j <= numContinuation; j++)
+		{
+			if ((bytes[i + j] & 0xC0) != 0x80)
+				return false;
+		}
+
+		i += numContinuation + 1;
+	}
+
+	return true;
+}
+
 DSGen::DSGen()
 {
 }
@@ -11,6 +72,114 @@ void DSGen::setDirectory(const std::filesystem::path& directory)
 	DSGen::directory = directory;
 
 	dumpTimeStamp = std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+	if (directory.empty())
+		return;
+
+	openArrayFile(classes, "ClassesInfo.json");
+	openArrayFile(functions, "FunctionsInfo.json");
+	openArrayFile(structs, "StructsInfo.json");
+	openArrayFile(enums, "EnumsInfo.json");
+}
+
+void DSGen::openArrayFile(JsonArrayFile& arrayFile, const std::string& fileName)
+{
+	arrayFile.file = BufferedFileWriter(directory / fileName);
+	arrayFile.hasElements = false;
+
+	// nlohmann::json sorts keys, so "data" is always the first one
+	arrayFile.file << "{\"data\":[";
+}
+
+void DSGen::writeArrayElement(JsonArrayFile& arrayFile, const std::string& element)
+{
+	if (!arrayFile.file.is_open())
+		return;
+
+	if (arrayFile.hasElements)
+		arrayFile.file << ',';
+
+	arrayFile.file << element;
+	arrayFile.hasElements = true;
+}
+
+void DSGen::closeArrayFile(JsonArrayFile& arrayFile)
+{
+	if (!arrayFile.file.is_open())
+		return;
+
+	arrayFile.file << "],\"updated_at\":";
+
+	std::string suffix;
+	appendString(suffix, dumpTimeStamp);
+	arrayFile.file << suffix;
+
+	arrayFile.file << ",\"version\":" << dumpspaceVersion << '}';
+	arrayFile.file.close();
+}
+
+void DSGen::appendString(std::string& out, const std::string& str)
+{
+	// invalid UTF-8 is rare enough to let nlohmann handle the replacement
+	if (!isValidUtf8(str))
+	{
+		out += nlohmann::json(str).dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
+		return;
+	}
+
+	constexpr const char* hexDigits = "0123456789abcdef";
+
+	out += '"';
+
+	for (const char c : str)
+	{
+		switch (c)
+		{
+		case '"':  out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\b': out += "\\b"; break;
+		case '\f': out += "\\f"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) <= 0x1F)
+			{
+				out += "\\u00";
+				out += hexDigits[(c >> 4) & 0xF];
+				out += hexDigits[c & 0xF];
+			}
+			else
+			{
+				out += c;
+			}
+			break;
+		}
+	}
+
+	out += '"';
+}
+
+void DSGen::appendMemberType(std::string& out, const MemberType& memberType)
+{
+	// [typeName, shortType, extendedType, [subTypes...]]
+	out += '[';
+	appendString(out, memberType.typeName);
+	out += ',';
+	appendString(out, getTypeShort(memberType.type));
+	out += ',';
+	appendString(out, memberType.extendedType);
+	out += ",[";
+
+	for (size_t i = 0; i < memberType.subTypes.size(); i++)
+	{
+		if (i > 0)
+			out += ',';
+
+		appendMemberType(out, memberType.subTypes[i]);
+	}
+
+	out += "]]";
 }
 
 void DSGen::addOffset(const std::string& name, uintptr_t offset)
@@ -109,77 +278,122 @@ void DSGen::createFunction(ClassHolder& owningClass, const std::string& function
 
 void DSGen::bakeStructOrClass(ClassHolder& classHolder)
 {
-	nlohmann::json jClass;
+	// {"className":[{"__InheritInfo":[...]},{"__MDKClassSize":size},{"memberName":[type,offset,size,arrayDim(,bitOffset)]},...]}
+	std::string jClass = "{";
+	appendString(jClass, classHolder.className);
+	jClass += ":[{\"__InheritInfo\":[";
 
-	nlohmann::json membersArray = nlohmann::json::array();
-
-	nlohmann::json inheritInfo = nlohmann::json::array();
-	for (auto super : classHolder.interitedTypes)
-		inheritInfo.push_back(super);
+	for (size_t i = 0; i < classHolder.interitedTypes.size(); i++)
+	{
+		if (i > 0)
+			jClass += ',';
 
-	nlohmann::json InheritInfo;
-	InheritInfo["__InheritInfo"] = inheritInfo;
-	membersArray.push_back(InheritInfo);
+		appendString(jClass, classHolder.interitedTypes[i]);
+	}
 
-	nlohmann::json gSize;
-	gSize["__MDKClassSize"] = classHolder.classSize;
-	membersArray.push_back(gSize);
+	jClass += "]},{\"__MDKClassSize\":";
+	jClass += std::to_string(classHolder.classSize);
+	jClass += '}';
 
-	for(auto& member : classHolder.members)
+	for (const auto& member : classHolder.members)
 	{
-		nlohmann::json jmember;
-
+		jClass += ",{";
+		appendString(jClass, member.memberName);
+		jClass += ":[";
+		appendMemberType(jClass, member.memberType);
+		jClass += ',';
+		jClass += std::to_string(member.offset);
+		jClass += ',';
+		jClass += std::to_string(member.size);
+		jClass += ',';
+		jClass += std::to_string(member.arrayDim);
 
 		if (member.bitOffset > -1)
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim, member.bitOffset);
-		else
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim);
-		membersArray.push_back(jmember);
+		{
+			jClass += ',';
+			jClass += std::to_string(member.bitOffset);
+		}
+
+		jClass += "]}";
 	}
-	nlohmann::json j;
 
-	j[classHolder.className] = membersArray;
+	jClass += "]}";
+
+	writeArrayElement(classHolder.classType == ET_Class ? classes : structs, jClass);
 
-	if (classHolder.classType == ET_Class)
-		classes.push_back(j);
-	else
-		structs.push_back(j);
+	if (classHolder.functions.empty())
+		return;
 
-	if(!classHolder.functions.empty())
+	// {"className":[{"functionName":[returnType,[[paramType,"&"|"",paramName],...],offset,flags]},...]}
+	std::string jFunctions = "{";
+	appendString(jFunctions, classHolder.className);
+	jFunctions += ":[";
+
+	for (size_t i = 0; i < classHolder.functions.size(); i++)
 	{
-		nlohmann::json classFunctions = nlohmann::json::array();
-		for (auto& func : classHolder.functions)
+		const FunctionHolder& func = classHolder.functions[i];
+
+		if (i > 0)
+			jFunctions += ',';
+
+		jFunctions += '{';
+		appendString(jFunctions, func.functionName);
+		jFunctions += ":[";
+		appendMemberType(jFunctions, func.returnType);
+		jFunctions += ",[";
+
+		for (size_t j = 0; j < func.functionParams.size(); j++)
 		{
-			nlohmann::json functionParams = nlohmann::json::array();
+			const auto& [paramType, paramName] = func.functionParams[j];
 
-			for (const auto& param : func.functionParams)
-				functionParams.push_back(std::make_tuple(param.first.jsonify(), param.first.reference ? "&" : "", param.second));
+			if (j > 0)
+				jFunctions += ',';
 
-			nlohmann::json j1;
-			j1[func.functionName] = std::make_tuple(func.returnType.jsonify(), functionParams, func.functionOffset, func.functionFlags);
-			classFunctions.push_back(j1);
+			jFunctions += '[';
+			appendMemberType(jFunctions, paramType);
+			jFunctions += paramType.reference ? ",\"&\"," : ",\"\",";
+			appendString(jFunctions, paramName);
+			jFunctions += ']';
 		}
-		nlohmann::json f;
-
-		f[classHolder.className] = classFunctions;
 
-		functions.push_back(f);
+		jFunctions += "],";
+		jFunctions += std::to_string(func.functionOffset);
+		jFunctions += ',';
+		appendString(jFunctions, func.functionFlags);
+		jFunctions += "]}";
 	}
 
+	jFunctions += "]}";
+
+	writeArrayElement(functions, jFunctions);
 }
 
 void DSGen::bakeEnum(EnumHolder& enumHolder)
 {
-	nlohmann::json members = nlohmann::json::array();
-	for(const auto& member : enumHolder.enumMembers)
+	// {"enumName":[[{"memberName":value},...],enumType]}
+	std::string jEnum = "{";
+	appendString(jEnum, enumHolder.enumName);
+	jEnum += ":[[";
+
+	for (size_t i = 0; i < enumHolder.enumMembers.size(); i++)
 	{
-		nlohmann::json m;
-		m[member.first] = member.second;
-		members.push_back(m);
+		const auto& [memberName, value] = enumHolder.enumMembers[i];
+
+		if (i > 0)
+			jEnum += ',';
+
+		jEnum += '{';
+		appendString(jEnum, memberName);
+		jEnum += ':';
+		jEnum += std::to_string(value);
+		jEnum += '}';
 	}
-	nlohmann::json j;
-	j[enumHolder.enumName] = std::make_tuple(members, enumHolder.enumType);
-	enums.push_back(j);
+
+	jEnum += "],";
+	appendString(jEnum, enumHolder.enumType);
+	jEnum += "]}";
+
+	writeArrayElement(enums, jEnum);
 }
 
 void DSGen::dump()
@@ -189,14 +403,12 @@ void DSGen::dump()
         return;
     }
 
-	constexpr auto version = 10202;
-
 	auto saveToDisk = [&](const nlohmann::json& json, const std::string& fileName, bool offsetFile = false)
 	{
 		nlohmann::json j;
 		j["updated_at"] = dumpTimeStamp;
 		j["data"] = json;
-		j["version"] = version;
+		j["version"] = dumpspaceVersion;
 
 		if(offsetFile){
 			nlohmann::json credit;
@@ -210,10 +422,11 @@ void DSGen::dump()
 	};
 
 	saveToDisk(nlohmann::json(nlohmann::json(offsets)), "OffsetsInfo.json", true);
-	saveToDisk(nlohmann::json(classes), "ClassesInfo.json");
-	saveToDisk(nlohmann::json(functions), "FunctionsInfo.json");
-	saveToDisk(nlohmann::json(structs), "StructsInfo.json");
-	saveToDisk(nlohmann::json(enums), "EnumsInfo.json");
-
+	offsets.clear();
 
+	// classes, functions, structs and enums were already written while baking
+	closeArrayFile(classes);
+	closeArrayFile(functions);
+	closeArrayFile(structs);
+	closeArrayFile(enums);
 }
@@ -3,6 +3,7 @@
 #include <string>
 #include <filesystem>
 #include "../Json/json.hpp"
+#include "../IO/BufferedFileWriter.h"
 
 class DSGen
 {
@@ -127,10 +128,25 @@ private:
 
 	static inline std::vector<std::tuple<std::string, uintptr_t>> offsets{};
 
-	static inline nlohmann::json classes = nlohmann::json::array();
-	static inline nlohmann::json structs = nlohmann::json::array();
-	static inline nlohmann::json functions = nlohmann::json::array();
-	static inline nlohmann::json enums = nlohmann::json::array();
+	// one of the "data" arrays, streamed to disk while baking so only the element currently being baked is held in memory
+	struct JsonArrayFile
+	{
+		BufferedFileWriter file;
+		bool hasElements;
+	};
+
+	static inline JsonArrayFile classes{};
+	static inline JsonArrayFile structs{};
+	static inline JsonArrayFile functions{};
+	static inline JsonArrayFile enums{};
+
+	static void openArrayFile(JsonArrayFile& arrayFile, const std::string& fileName);
+	static void writeArrayElement(JsonArrayFile& arrayFile, const std::string& element);
+	static void closeArrayFile(JsonArrayFile& arrayFile);
+
+	// appends the JSON representation, formatted exactly like nlohmann::json::dump(-1, ' ', false, error_handler_t::replace)
+	static void appendString(std::string& out, const std::string& str);
+	static void appendMemberType(std::string& out, const MemberType& memberType);
 
 public:
 	//redundant constructor
@@ -259,20 +275,20 @@ public:
 	);
 
 	/**
-	 * \brief bakes a ClassHolder which gets later dumped
+	 * \brief bakes a ClassHolder and writes it to its file right away. setDirectory must be called first
 	 * \param classHolder the classHolder that should get baked
 	 */
 	static void bakeStructOrClass(ClassHolder& classHolder);
 
 	/**
-	 * \brief bakes a EnumHolder which gets later dumped
+	 * \brief bakes a EnumHolder and writes it to its file right away. setDirectory must be called first
 	 * \param enumHolder the enumHolder that should get baked
 	 */
 	static void bakeEnum(EnumHolder& enumHolder);
 
 
 	/**
-	 * \brief dumps all baked information to disk. This should be the final step
+	 * \brief finishes all files and dumps the offsets to disk. This should be the final step
 	 */
 	static void dump();
 };
\ No newline at end of file
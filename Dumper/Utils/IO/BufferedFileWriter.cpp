@@ -0,0 +1,130 @@
+#include "IO/BufferedFileWriter.h"
+#include "Settings.h"
+#include "Menu/Logger.h"
+
+
+BufferedFileWriter::BufferedFileWriter(const fs::path& Path, std::ios::openmode Mode, bool bBackgroundThread, size_t Threshold)
+	: File(Path, Mode | std::ios::binary), FilePath(Path), FlushThreshold(Threshold), bUseBackgroundThread(bBackgroundThread)
+{
+	if (!File.is_open())
+	{
+		LogError("BufferedFileWriter: Failed to open '%s'", FilePath.string().c_str());
+		return;
+	}
+
+	Buffer.reserve(FlushThreshold + 0x1000);
+}
+
+BufferedFileWriter::BufferedFileWriter(BufferedFileWriter&& Other) noexcept
+{
+	*this = std::move(Other);
+}
+
+BufferedFileWriter& BufferedFileWriter::operator=(BufferedFileWriter&& Other) noexcept
+{
+	if (this == &Other)
+		return *this;
+
+	close();
+	Other.WaitForPendingWrite();
+
+	File = std::move(Other.File);
+	FilePath = std::move(Other.FilePath);
+	Buffer = std::move(Other.Buffer);
+	BackBuffer = std::move(Other.BackBuffer);
+	FlushThreshold = Other.FlushThreshold;
+	bUseBackgroundThread = Other.bUseBackgroundThread;
+	Stats = Other.Stats;
+
+	Other.Stats = FileWriterStats();
+
+	return *this;
+}
+
+BufferedFileWriter::~BufferedFileWriter()
+{
+	close();
+}
+
+void BufferedFileWriter::WaitForPendingWrite()
+{
+	if (PendingWrite.valid())
+		PendingWrite.get();
+}
+
+void BufferedFileWriter::SubmitBuffer()
+{
+	if (Buffer.empty())
+		return;
+
+	Stats.BytesWritten += Buffer.size();
+	Stats.NumFlushes++;
+
+	if (!bUseBackgroundThread)
+	{
+		File.write(Buffer.data(), Buffer.size());
+		Buffer.clear();
+
+		return;
+	}
+
+	/* The previous buffer has to be written out before it can be reused */
+	WaitForPendingWrite();
+
+	std::swap(Buffer, BackBuffer);
+	Buffer.clear();
+
+	PendingWrite = std::async(std::launch::async, [this]() -> void
+	{
+		File.write(BackBuffer.data(), BackBuffer.size());
+	});
+}
+
+void BufferedFileWriter::flush()
+{
+	SubmitBuffer();
+	WaitForPendingWrite();
+
+	File.flush();
+}
+
+void BufferedFileWriter::close()
+{
+	if (!File.is_open())
+		return;
+
+	flush();
+	File.close();
+
+	/* failbit/badbit are sticky, so this catches failed writes from the I/O thread as well as a failed close */
+	if (File.fail())
+	{
+		LogError("BufferedFileWriter: Failed to write '%s' (%llu bytes buffered)", FilePath.string().c_str(), Stats.BytesWritten);
+		TotalNumFailedFiles++;
+	}
+
+	TotalBytesWritten += Stats.BytesWritten;
+	TotalNumFlushes += Stats.NumFlushes;
+	TotalNumFiles++;
+
+	if constexpr (Settings::Debug::bLogFileWriterStats)
+		LogInfo("Wrote '%s': %llu bytes in %llu flushes", FilePath.filename().string().c_str(), Stats.BytesWritten, Stats.NumFlushes);
+}
+
+FileWriterStats BufferedFileWriter::GetTotalStats()
+{
+	return { TotalBytesWritten.load(), TotalNumFlushes.load() };
+}
+
+void BufferedFileWriter::LogTotalStats()
+{
+	const uint64_t NumFiles = TotalNumFiles.exchange(0x0);
+	const uint64_t BytesWritten = TotalBytesWritten.exchange(0x0);
+	const uint64_t NumFlushes = TotalNumFlushes.exchange(0x0);
+	const uint64_t NumFailedFiles = TotalNumFailedFiles.exchange(0x0);
+
+	LogInfo("File output: %llu files, %llu bytes in %llu flushes", NumFiles, BytesWritten, NumFlushes);
+
+	if (NumFailedFiles > 0x0)
+		LogError("File output: %llu of %llu files could not be written completely", NumFailedFiles, NumFiles);
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <format>
+#include <string>
+#include <future>
+#include <iterator>
+#include <cstdint>
+#include <fstream>
+#include <charconv>
+#include <filesystem>
+#include <string_view>
+#include <type_traits>
+
+namespace fs = std::filesystem;
+
+struct FileWriterStats
+{
+	uint64_t BytesWritten = 0x0;
+	uint64_t NumFlushes = 0x0;
+};
+
+/*
+* Output file that collects everything in a large buffer and writes it out in big chunks, instead of one write per operator<<.
+*
+* Drop-in for the parts of std::ofstream used by the generators (operator<<, write(), is_open(), close()). With 'bUseBackgroundThread'
+* a full buffer is handed to an I/O thread and filling continues in a second buffer while it is being written.
+*/
+class BufferedFileWriter
+{
+public:
+	static constexpr size_t DefaultFlushThreshold = 0x100000; // 1MB
+
+private:
+	static inline std::atomic<uint64_t> TotalBytesWritten = 0x0;
+	static inline std::atomic<uint64_t> TotalNumFlushes = 0x0;
+	static inline std::atomic<uint64_t> TotalNumFiles = 0x0;
+	static inline std::atomic<uint64_t> TotalNumFailedFiles = 0x0;
+
+private:
+	std::ofstream File;
+	fs::path FilePath;
+
+	std::string Buffer;
+	std::string BackBuffer;
+	std::future<void> PendingWrite;
+
+	size_t FlushThreshold = DefaultFlushThreshold;
+	bool bUseBackgroundThread = false;
+
+	FileWriterStats Stats;
+
+public:
+	BufferedFileWriter() = default;
+	explicit BufferedFileWriter(const fs::path& Path, std::ios::openmode Mode = std::ios::out, bool bBackgroundThread = false, size_t Threshold = DefaultFlushThreshold);
+
+	BufferedFileWriter(BufferedFileWriter&& Other) noexcept;
+	BufferedFileWriter& operator=(BufferedFileWriter&& Other) noexcept;
+
+	BufferedFileWriter(const BufferedFileWriter&) = delete;
+	BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+	~BufferedFileWriter();
+
+private:
+	void WaitForPendingWrite();
+	void SubmitBuffer();
+
+	inline void OnAppend()
+	{
+		if (Buffer.size() >= FlushThreshold)
+			SubmitBuffer();
+	}
+
+public:
+	inline bool is_open() const { return File.is_open(); }
+
+	inline BufferedFileWriter& write(const char* Data, std::streamsize Size)
+	{
+		Buffer.append(Data, static_cast<size_t>(Size));
+		OnAppend();
+
+		return *this;
+	}
+
+	/* Writes everything buffered so far to the file */
+	void flush();
+	void close();
+
+	inline const FileWriterStats& GetStats() const { return Stats; }
+	inline const fs::path& GetPath() const { return FilePath; }
+
+	/* Summed over all files closed since the last call to LogTotalStats() */
+	static FileWriterStats GetTotalStats();
+
+	/* Logs the totals and resets them, so every generator reports only its own output */
+	static void LogTotalStats();
+
+public:
+	inline BufferedFileWriter& operator<<(std::string_view String)
+	{
+		Buffer.append(String);
+		OnAppend();
+
+		return *this;
+	}
+
+	inline BufferedFileWriter& operator<<(const std::string& String) { return *this << std::string_view(String); }
+	inline BufferedFileWriter& operator<<(const char* String) { return *this << std::string_view(String); }
+
+	inline BufferedFileWriter& operator<<(char Char)
+	{
+		Buffer.push_back(Char);
+		OnAppend();
+
+		return *this;
+	}
+
+	template<typename T> requires(std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>)
+	inline BufferedFileWriter& operator<<(T Value)
+	{
+		char Digits[0x18];
+		const auto [End, Error] = std::to_chars(Digits, Digits + sizeof(Digits), Value);
+
+		return *this << std::string_view(Digits, End - Digits);
+	}
+
+	/* Appends directly into the buffer, without a temporary std::string */
+	template<typename... ArgTypes>
+	inline BufferedFileWriter& Format(std::format_string<ArgTypes...> Fmt, ArgTypes&&... Args)
+	{
+		std::format_to(std::back_inserter(Buffer), Fmt, std::forward<ArgTypes>(Args)...);
+		OnAppend();
+
+		return *this;
+	}
+};
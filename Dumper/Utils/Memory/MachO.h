@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__APPLE__)
+
+#include <mach/mach.h>
+#include <mach-o/dyld.h>
+#include <mach-o/loader.h>
+#include <mach-o/getsect.h>
+
+#else
+
+/*
+* Minimal subset of <mach/vm_prot.h> and <mach-o/loader.h>.
+*
+* Only used when the dumper runs on a non-Apple host from a process snapshot (see Memory/MemoryReader.h). The Mach-O images
+* inside of the snapshot are mapped at their original addresses, so their load commands can be walked exactly like on device.
+*/
+
+#define VM_PROT_NONE    0x0
+#define VM_PROT_READ    0x1
+#define VM_PROT_WRITE   0x2
+#define VM_PROT_EXECUTE 0x4
+
+#define MH_MAGIC_64   0xFEEDFACF
+#define LC_SEGMENT_64 0x19
+#define LC_UUID       0x1B
+
+struct mach_header_64
+{
+	uint32_t magic;
+	int32_t cputype;
+	int32_t cpusubtype;
+	uint32_t filetype;
+	uint32_t ncmds;
+	uint32_t sizeofcmds;
+	uint32_t flags;
+	uint32_t reserved;
+};
+
+struct load_command
+{
+	uint32_t cmd;
+	uint32_t cmdsize;
+};
+
+struct segment_command_64
+{
+	uint32_t cmd;
+	uint32_t cmdsize;
+	char segname[16];
+	uint64_t vmaddr;
+	uint64_t vmsize;
+	uint64_t fileoff;
+	uint64_t filesize;
+	int32_t maxprot;
+	int32_t initprot;
+	uint32_t nsects;
+	uint32_t flags;
+};
+
+struct uuid_command
+{
+	uint32_t cmd;
+	uint32_t cmdsize;
+	uint8_t uuid[16];
+};
+
+#endif
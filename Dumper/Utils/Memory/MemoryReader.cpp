@@ -0,0 +1,595 @@
+#include <array>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Memory/MemoryReader.h"
+#include "Menu/Logger.h"
+
+
+/* First region in a sorted list that ends after 'Address'. It either contains 'Address' or is the next region after it. */
+static inline std::vector<MemoryRegion>::const_iterator FindRegionAfter(const std::vector<MemoryRegion>& Regions, uintptr_t Address)
+{
+	return std::upper_bound(Regions.begin(), Regions.end(), Address, [](uintptr_t Addr, const MemoryRegion& Region) { return Addr < Region.End(); });
+}
+
+bool MemoryReader::IsReadable(uintptr_t Address, size_t Size) const
+{
+	const uintptr_t End = Address + Size;
+
+	MemoryRegion Region;
+	while (Address < End)
+	{
+		if (!QueryRegion(Address, Region) || !Region.Contains(Address))
+			return false;
+
+		Address = Region.End();
+	}
+
+	return true;
+}
+
+
+#if defined(__APPLE__)
+/* Cuts [Start, End) out of a sorted, non-overlapping list. Entries reaching into it are trimmed, one spanning it is split in two. Returns where [Start, End) belongs. */
+static std::vector<MemoryRegion>::iterator CarveRange(std::vector<MemoryRegion>& Regions, uintptr_t Start, uintptr_t End)
+{
+	auto First = FindRegionAfter(Regions, Start);
+	auto Last = std::lower_bound(First, Regions.cend(), End, [](const MemoryRegion& Region, uintptr_t Addr) { return Region.Start < Addr; });
+
+	if (First == Last)
+		return Regions.begin() + (First - Regions.cbegin());
+
+	std::array<MemoryRegion, 2> Remainders;
+	size_t NumRemainders = 0;
+
+	if (First->Start < Start)
+		Remainders[NumRemainders++] = { First->Start, Start - First->Start, First->Protection };
+
+	if (const MemoryRegion& LastOverlapping = *std::prev(Last); LastOverlapping.End() > End)
+		Remainders[NumRemainders++] = { End, LastOverlapping.End() - End, LastOverlapping.Protection };
+
+	auto InsertAt = Regions.erase(First, Last);
+	InsertAt = Regions.insert(InsertAt, Remainders.begin(), Remainders.begin() + NumRemainders);
+
+	/* Between the left and the right remainder */
+	return (NumRemainders > 0 && Remainders[0].Start < Start) ? InsertAt + 1 : InsertAt;
+}
+
+/* Inserts 'Region' into a sorted, non-overlapping list, whatever it overlaps is trimmed. */
+static void InsertRegion(std::vector<MemoryRegion>& Regions, const MemoryRegion& Region)
+{
+	Regions.insert(CarveRange(Regions, Region.Start, Region.End()), Region);
+}
+
+LiveMemoryReader::LiveMemoryReader()
+{
+	RefreshImages();
+}
+
+bool LiveMemoryReader::Read(uintptr_t Address, void* OutBuffer, size_t Size) const
+{
+	vm_size_t OutSize = 0;
+	const kern_return_t KR = vm_read_overwrite(mach_task_self(), (vm_address_t)Address, Size, (vm_address_t)OutBuffer, &OutSize);
+
+	return KR == KERN_SUCCESS && OutSize == Size;
+}
+
+bool LiveMemoryReader::QueryRegion(uintptr_t Address, MemoryRegion& OutRegion) const
+{
+	vm_address_t VmAddr = (vm_address_t)Address;
+
+	while (true)
+	{
+		vm_size_t VmSize = 0;
+		vm_region_basic_info_data_64_t Info;
+		mach_msg_type_number_t Count = VM_REGION_BASIC_INFO_COUNT_64;
+		memory_object_name_t Obj;
+
+		/* vm_region_64 returns the region containing VmAddr, or the next one after it */
+		if (vm_region_64(mach_task_self(), &VmAddr, &VmSize, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&Info, &Count, &Obj) != KERN_SUCCESS)
+			return false;
+
+		if (Info.protection & VM_PROT_READ)
+		{
+			OutRegion = { (uintptr_t)VmAddr, (size_t)VmSize, (uint32_t)Info.protection };
+			return true;
+		}
+
+		VmAddr += VmSize;
+	}
+}
+
+const std::vector<MemoryImage>& LiveMemoryReader::GetImages() const
+{
+	return Images;
+}
+
+bool LiveMemoryReader::IsLive() const
+{
+	return true;
+}
+
+bool LiveMemoryReader::IsReadable(uintptr_t Address, size_t Size) const
+{
+	const uintptr_t End = Address + (Size ? Size : 1);
+
+	MemoryRegion Region;
+	while (Address < End)
+	{
+		switch (FindCachedRegion(Address, Region))
+		{
+		case ECachedState::Readable:
+			CacheHits.fetch_add(1, std::memory_order_relaxed);
+			break;
+
+		case ECachedState::Unreadable:
+			CacheHits.fetch_add(1, std::memory_order_relaxed);
+			return false;
+
+		case ECachedState::Unknown:
+			CacheMisses.fetch_add(1, std::memory_order_relaxed);
+
+			if (!RefreshRegionAt(Address, Region))
+				return false;
+
+			break;
+		}
+
+		Address = Region.End();
+	}
+
+	return true;
+}
+
+MemoryReaderStats LiveMemoryReader::GetStats() const
+{
+	return {
+		CacheHits.load(std::memory_order_relaxed),
+		CacheMisses.load(std::memory_order_relaxed),
+		CacheRebuilds.load(std::memory_order_relaxed),
+		RegionInserts.load(std::memory_order_relaxed)
+	};
+}
+
+void LiveMemoryReader::InvalidateCache()
+{
+	RefreshRegionCache();
+}
+
+void LiveMemoryReader::RefreshRegionCache()
+{
+	std::unique_lock Lock(RegionCacheLock);
+
+	bRegionCacheBuilt = false;
+	CachedRegions.clear();
+	CachedHoles.clear();
+}
+
+void LiveMemoryReader::BuildRegionCache() const
+{
+	/* Caller holds the lock exclusively */
+	CachedRegions.clear();
+	CachedHoles.clear();
+
+	vm_address_t VmAddr = 0x0;
+	while (true)
+	{
+		vm_size_t VmSize = 0;
+		vm_region_basic_info_data_64_t Info;
+		mach_msg_type_number_t Count = VM_REGION_BASIC_INFO_COUNT_64;
+		memory_object_name_t Obj;
+
+		if (vm_region_64(mach_task_self(), &VmAddr, &VmSize, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&Info, &Count, &Obj) != KERN_SUCCESS)
+			break;
+
+		if (Info.protection & VM_PROT_READ)
+		{
+			/* Merge adjacent readable regions, a lookup only cares about readability */
+			if (!CachedRegions.empty() && CachedRegions.back().End() == VmAddr)
+			{
+				CachedRegions.back().Size += VmSize;
+			}
+			else
+			{
+				CachedRegions.push_back({ (uintptr_t)VmAddr, (size_t)VmSize, (uint32_t)Info.protection });
+			}
+		}
+
+		VmAddr += VmSize;
+	}
+
+	bRegionCacheBuilt = true;
+	CacheRebuilds.fetch_add(1, std::memory_order_relaxed);
+}
+
+LiveMemoryReader::ECachedState LiveMemoryReader::FindCachedRegion(uintptr_t Address, MemoryRegion& OutRegion) const
+{
+	/* Caller holds the lock, shared or exclusive */
+	auto Lookup = [&]() -> ECachedState
+	{
+		auto It = FindRegionAfter(CachedRegions, Address);
+
+		if (It != CachedRegions.end() && It->Contains(Address))
+		{
+			OutRegion = *It;
+			return ECachedState::Readable;
+		}
+
+		It = FindRegionAfter(CachedHoles, Address);
+
+		return (It != CachedHoles.end() && It->Contains(Address)) ? ECachedState::Unreadable : ECachedState::Unknown;
+	};
+
+	{
+		std::shared_lock Lock(RegionCacheLock);
+
+		if (bRegionCacheBuilt) [[likely]]
+			return Lookup();
+	}
+
+	std::unique_lock Lock(RegionCacheLock);
+
+	if (!bRegionCacheBuilt)
+		BuildRegionCache();
+
+	return Lookup();
+}
+
+bool LiveMemoryReader::RefreshRegionAt(uintptr_t Address, MemoryRegion& OutRegion) const
+{
+	vm_address_t VmAddr = (vm_address_t)Address;
+	vm_size_t VmSize = 0;
+	vm_region_basic_info_data_64_t Info;
+	mach_msg_type_number_t Count = VM_REGION_BASIC_INFO_COUNT_64;
+	memory_object_name_t Obj;
+
+	const kern_return_t KR = vm_region_64(mach_task_self(), &VmAddr, &VmSize, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&Info, &Count, &Obj);
+
+	/* The kernel doesn't say where a gap starts, the hole begins at the page of 'Address' */
+	const uintptr_t PageStart = Address & ~(uintptr_t)(vm_page_size - 1);
+
+	MemoryRegion Hole;
+
+	if (KR != KERN_SUCCESS)
+	{
+		/* Nothing is mapped at or after 'Address' */
+		Hole = { PageStart, UINTPTR_MAX - PageStart, 0 };
+	}
+	else if (VmAddr > Address)
+	{
+		/* vm_region_64 moved VmAddr to the next region, 'Address' isn't mapped */
+		Hole = { PageStart, (uintptr_t)VmAddr - PageStart, 0 };
+	}
+	else if (!(Info.protection & VM_PROT_READ))
+	{
+		Hole = { (uintptr_t)VmAddr, (size_t)VmSize, (uint32_t)Info.protection };
+	}
+	else
+	{
+		const MemoryRegion Region = { (uintptr_t)VmAddr, (size_t)VmSize, (uint32_t)Info.protection };
+
+		std::unique_lock Lock(RegionCacheLock);
+
+		/* The region was mapped after the cache was built, or grew into a gap. Whatever it overlaps is outdated. */
+		CarveRange(CachedHoles, Region.Start, Region.End());
+		InsertRegion(CachedRegions, Region);
+
+		RegionInserts.fetch_add(1, std::memory_order_relaxed);
+
+		OutRegion = Region;
+		return true;
+	}
+
+	std::unique_lock Lock(RegionCacheLock);
+
+	CarveRange(CachedRegions, Hole.Start, Hole.End());
+	InsertRegion(CachedHoles, Hole);
+
+	RegionInserts.fetch_add(1, std::memory_order_relaxed);
+
+	return false;
+}
+
+void LiveMemoryReader::RefreshImages()
+{
+	Images.clear();
+
+	const uint32_t Count = _dyld_image_count();
+	Images.reserve(Count);
+
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		const char* Name = _dyld_get_image_name(i);
+
+		Images.push_back({ Name ? Name : "", (uintptr_t)_dyld_get_image_header(i), _dyld_get_image_vmaddr_slide(i) });
+	}
+}
+#endif // __APPLE__
+
+
+SnapshotMemoryReader::~SnapshotMemoryReader()
+{
+	for (const auto& [MappingStart, MappingSize] : Mappings)
+		munmap(reinterpret_cast<void*>(MappingStart), MappingSize);
+}
+
+uint8_t* SnapshotMemoryReader::MapRegion(const MemoryRegion& Region)
+{
+	const uintptr_t PageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+
+	const uintptr_t AlignedStart = Region.Start & ~(PageSize - 1);
+	const uintptr_t AlignedEnd = (Region.End() + PageSize - 1) & ~(PageSize - 1);
+
+	/* Regions are sorted, so if the host page size is bigger than the one on device, the last mapping might already cover the start of this region */
+	const uintptr_t LastMappingEnd = !Mappings.empty() ? (Mappings.back().first + Mappings.back().second) : 0x0;
+	const uintptr_t MapStart = std::max(AlignedStart, LastMappingEnd);
+
+	if (MapStart >= AlignedEnd)
+		return reinterpret_cast<uint8_t*>(Region.Start);
+
+	int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_FIXED_NOREPLACE)
+	Flags |= MAP_FIXED_NOREPLACE;
+#endif
+
+	void* Mapped = mmap(reinterpret_cast<void*>(MapStart), AlignedEnd - MapStart, PROT_READ | PROT_WRITE, Flags, -1, 0);
+
+	if (Mapped == MAP_FAILED)
+		return nullptr;
+
+	/* Without MAP_FIXED_NOREPLACE the address is only a hint */
+	if (reinterpret_cast<uintptr_t>(Mapped) != MapStart)
+	{
+		munmap(Mapped, AlignedEnd - MapStart);
+		return nullptr;
+	}
+
+	Mappings.emplace_back(MapStart, AlignedEnd - MapStart);
+
+	return reinterpret_cast<uint8_t*>(Region.Start);
+}
+
+bool SnapshotMemoryReader::Load(const fs::path& SnapshotPath)
+{
+	std::ifstream SnapshotFile(SnapshotPath, std::ios::binary);
+
+	if (!SnapshotFile)
+	{
+		LogError("Could not open process snapshot '%s'", SnapshotPath.string().c_str());
+		return false;
+	}
+
+	auto ReadValue = [&SnapshotFile](auto& OutValue) -> bool
+	{
+		return static_cast<bool>(SnapshotFile.read(reinterpret_cast<char*>(&OutValue), sizeof(OutValue)));
+	};
+
+	SnapshotHeader Header;
+	if (!ReadValue(Header) || Header.Magic != SnapshotHeader::SnapshotMagic || Header.Version != SnapshotHeader::SnapshotVersion)
+	{
+		LogError("'%s' is not a process snapshot of version %d", SnapshotPath.string().c_str(), SnapshotHeader::SnapshotVersion);
+		return false;
+	}
+
+	Images.reserve(Header.NumImages);
+	for (uint32_t i = 0; i < Header.NumImages; i++)
+	{
+		uint64_t HeaderAddress = 0x0;
+		int64_t Slide = 0x0;
+		uint32_t NameLength = 0x0;
+
+		if (!ReadValue(HeaderAddress) || !ReadValue(Slide) || !ReadValue(NameLength))
+			return false;
+
+		std::string Name(NameLength, '\0');
+		if (!SnapshotFile.read(Name.data(), NameLength))
+			return false;
+
+		Images.push_back({ std::move(Name), static_cast<uintptr_t>(HeaderAddress), static_cast<intptr_t>(Slide) });
+	}
+
+	Regions.reserve(Header.NumRegions);
+	for (uint32_t i = 0; i < Header.NumRegions; i++)
+	{
+		uint64_t Start = 0x0;
+		uint64_t Size = 0x0;
+		uint32_t Protection = 0x0;
+		uint32_t Reserved = 0x0;
+
+		if (!ReadValue(Start) || !ReadValue(Size) || !ReadValue(Protection) || !ReadValue(Reserved))
+			return false;
+
+		const MemoryRegion Region = { static_cast<uintptr_t>(Start), static_cast<size_t>(Size), Protection };
+
+		if (!Regions.empty() && Region.Start < Regions.back().End())
+		{
+			LogError("Process snapshot regions are overlapping or unsorted (0x%llX)", (unsigned long long)Start);
+			return false;
+		}
+
+		uint8_t* Target = MapRegion(Region);
+
+		if (!Target)
+		{
+			LogError("Could not map snapshot region [0x%llX, 0x%llX), the address range is already in use", (unsigned long long)Start, (unsigned long long)(Start + Size));
+			return false;
+		}
+
+		if (!SnapshotFile.read(reinterpret_cast<char*>(Target), Size))
+			return false;
+
+		Regions.push_back(Region);
+	}
+
+	/* The dumper never writes to the memory of the game, make sure it doesn't start doing so */
+	for (const auto& [MappingStart, MappingSize] : Mappings)
+		mprotect(reinterpret_cast<void*>(MappingStart), MappingSize, PROT_READ);
+
+	LogSuccess("Loaded process snapshot '%s' (%d images, %d regions)", SnapshotPath.string().c_str(), Header.NumImages, Header.NumRegions);
+	return true;
+}
+
+bool SnapshotMemoryReader::Read(uintptr_t Address, void* OutBuffer, size_t Size) const
+{
+	if (!IsReadable(Address, Size))
+		return false;
+
+	memcpy(OutBuffer, reinterpret_cast<const void*>(Address), Size);
+	return true;
+}
+
+bool SnapshotMemoryReader::QueryRegion(uintptr_t Address, MemoryRegion& OutRegion) const
+{
+	auto It = FindRegionAfter(Regions, Address);
+
+	if (It == Regions.end())
+		return false;
+
+	OutRegion = *It;
+	return true;
+}
+
+const std::vector<MemoryImage>& SnapshotMemoryReader::GetImages() const
+{
+	return Images;
+}
+
+bool SnapshotMemoryReader::IsLive() const
+{
+	return false;
+}
+
+
+namespace Memory
+{
+	static std::unique_ptr<MemoryReader> CurrentReader;
+
+	MemoryReader& GetReader()
+	{
+		if (!CurrentReader) [[unlikely]]
+		{
+#if defined(__APPLE__)
+			CurrentReader = std::make_unique<LiveMemoryReader>();
+#else
+			/* There is no live process to read from on other hosts, everything stays unreadable until a snapshot is loaded */
+			CurrentReader = std::make_unique<SnapshotMemoryReader>();
+#endif
+		}
+
+		return *CurrentReader;
+	}
+
+	void SetReader(std::unique_ptr<MemoryReader> NewReader)
+	{
+		CurrentReader = std::move(NewReader);
+	}
+
+	bool LoadSnapshot(const fs::path& SnapshotPath)
+	{
+		auto Snapshot = std::make_unique<SnapshotMemoryReader>();
+
+		if (!Snapshot->Load(SnapshotPath))
+			return false;
+
+		SetReader(std::move(Snapshot));
+		return true;
+	}
+
+	bool WriteSnapshot([[maybe_unused]] const fs::path& SnapshotPath)
+	{
+#if defined(__APPLE__)
+		MemoryReader& Reader = GetReader();
+
+		if (!Reader.IsLive())
+		{
+			LogError("A process snapshot can only be written from the live process");
+			return false;
+		}
+
+		std::ofstream SnapshotFile(SnapshotPath, std::ios::binary);
+
+		if (!SnapshotFile)
+		{
+			LogError("Could not create process snapshot '%s'", SnapshotPath.string().c_str());
+			return false;
+		}
+
+		auto WriteValue = [&SnapshotFile](const auto& Value)
+		{
+			SnapshotFile.write(reinterpret_cast<const char*>(&Value), sizeof(Value));
+		};
+
+		SnapshotMemoryReader::SnapshotHeader Header;
+		Header.NumImages = static_cast<uint32_t>(Reader.GetImages().size());
+
+		/* NumRegions is patched once all regions were written */
+		WriteValue(Header);
+
+		for (const MemoryImage& Image : Reader.GetImages())
+		{
+			WriteValue(static_cast<uint64_t>(Image.HeaderAddress));
+			WriteValue(static_cast<int64_t>(Image.Slide));
+			WriteValue(static_cast<uint32_t>(Image.Name.size()));
+			SnapshotFile.write(Image.Name.data(), Image.Name.size());
+		}
+
+		constexpr size_t CopyChunkSize = 0x100000;
+		std::vector<uint8_t> CopyBuffer(CopyChunkSize);
+
+		uint64_t TotalBytes = 0x0;
+
+		vm_address_t VmAddr = 0x0;
+		while (true)
+		{
+			vm_size_t VmSize = 0;
+			vm_region_basic_info_data_64_t Info;
+			mach_msg_type_number_t Count = VM_REGION_BASIC_INFO_COUNT_64;
+			memory_object_name_t Obj;
+
+			if (vm_region_64(mach_task_self(), &VmAddr, &VmSize, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&Info, &Count, &Obj) != KERN_SUCCESS)
+				break;
+
+			/* Skip the dyld shared cache and other shared mappings, the engine doesn't keep reflection data in there */
+			if (!(Info.protection & VM_PROT_READ) || Info.shared)
+			{
+				VmAddr += VmSize;
+				continue;
+			}
+
+			WriteValue(static_cast<uint64_t>(VmAddr));
+			WriteValue(static_cast<uint64_t>(VmSize));
+			WriteValue(static_cast<uint32_t>(Info.protection));
+			WriteValue(static_cast<uint32_t>(0x0));
+
+			for (vm_size_t Offset = 0; Offset < VmSize; Offset += CopyChunkSize)
+			{
+				const size_t ChunkSize = std::min<size_t>(CopyChunkSize, VmSize - Offset);
+
+				/* Pages can become unreadable between vm_region_64 and the copy, keep the layout intact and write zeros for them */
+				if (!Reader.Read(VmAddr + Offset, CopyBuffer.data(), ChunkSize))
+					memset(CopyBuffer.data(), 0, ChunkSize);
+
+				SnapshotFile.write(reinterpret_cast<const char*>(CopyBuffer.data()), ChunkSize);
+			}
+
+			TotalBytes += VmSize;
+			Header.NumRegions++;
+
+			VmAddr += VmSize;
+		}
+
+		SnapshotFile.seekp(0);
+		WriteValue(Header);
+
+		LogSuccess("Wrote process snapshot '%s' (%d regions, 0x%llX bytes)", SnapshotPath.string().c_str(), Header.NumRegions, TotalBytes);
+		return static_cast<bool>(SnapshotFile);
+#else
+		LogError("A process snapshot can only be written from the live process");
+		return false;
+#endif
+	}
+}
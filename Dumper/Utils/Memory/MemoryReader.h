@@ -0,0 +1,221 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+
+#include "Memory/MachO.h"
+
+namespace fs = std::filesystem;
+
+struct MemoryImage
+{
+	std::string Name;
+	uintptr_t HeaderAddress;
+	intptr_t Slide;
+};
+
+struct MemoryRegion
+{
+	uintptr_t Start;
+	size_t Size;
+	uint32_t Protection; // VM_PROT_* flags
+
+	inline uintptr_t End() const { return Start + Size; }
+	inline bool Contains(uintptr_t Address) const { return Address >= Start && Address < End(); }
+};
+
+struct MemoryReaderStats
+{
+	uint64_t CacheHits;
+	uint64_t CacheMisses;
+
+	/* Full rebuilds of the region cache, one per invalidation */
+	uint64_t CacheRebuilds;
+
+	/* Single regions, readable or not, queried on a miss and added to the cache */
+	uint64_t RegionInserts;
+};
+
+/*
+* Backend through which the engine layer accesses the memory of the process that is being dumped.
+*
+* The pointer-chasing accessors (UEObject, FName, ObjectArray, ...) keep dereferencing raw addresses, every backend guarantees that
+* readable addresses are mapped at their original location in the current process. What goes through the reader are the checks and
+* queries that would otherwise require the Mach kernel or dyld: IsBadReadPtr, SafeRead, region walking for pattern scans and the list
+* of loaded images.
+*/
+class MemoryReader
+{
+public:
+	virtual ~MemoryReader() = default;
+
+public:
+	/* Copies 'Size' bytes starting at 'Address' into 'OutBuffer'. Returns false if any of the bytes can't be read. */
+	virtual bool Read(uintptr_t Address, void* OutBuffer, size_t Size) const = 0;
+
+	/* Finds the first readable region that contains 'Address', or, if 'Address' isn't readable, the first readable region after it. */
+	virtual bool QueryRegion(uintptr_t Address, MemoryRegion& OutRegion) const = 0;
+
+	/* Images (main executable first) loaded in the process. */
+	virtual const std::vector<MemoryImage>& GetImages() const = 0;
+
+	/* Whether this reader is backed by the live process, and game functions (ProcessEvent, AppendString, ...) can be called. */
+	virtual bool IsLive() const = 0;
+
+public:
+	virtual bool IsReadable(uintptr_t Address, size_t Size = 1) const;
+
+	/* Counters of the readability cache, if the backend has one. */
+	virtual MemoryReaderStats GetStats() const { return {}; }
+
+	/* Forgets everything cached about the address space, the next check re-queries it. */
+	virtual void InvalidateCache() {}
+};
+
+#if defined(__APPLE__)
+class LiveMemoryReader : public MemoryReader
+{
+private:
+	std::vector<MemoryImage> Images;
+
+	/*
+	* Sorted, non-overlapping list of readable VM regions. Built with a single vm_region_64 walk on the first check, lookups that
+	* miss re-query the kernel for that one address and insert the region if it was mapped after the cache was built.
+	* Addresses the kernel reported as unmapped or unreadable go into CachedHoles, so repeated probes of them don't trap either.
+	*
+	* The cache doesn't notice memory being unmapped. Memory::InvalidateRegionCache() drops it at the start of every GObjects walk.
+	*/
+	mutable std::shared_mutex RegionCacheLock;
+	mutable std::vector<MemoryRegion> CachedRegions;
+	mutable std::vector<MemoryRegion> CachedHoles;
+	mutable bool bRegionCacheBuilt = false;
+
+	mutable std::atomic<uint64_t> CacheHits = 0;
+	mutable std::atomic<uint64_t> CacheMisses = 0;
+	mutable std::atomic<uint64_t> CacheRebuilds = 0;
+	mutable std::atomic<uint64_t> RegionInserts = 0;
+
+public:
+	LiveMemoryReader();
+
+public:
+	bool Read(uintptr_t Address, void* OutBuffer, size_t Size) const override;
+	bool QueryRegion(uintptr_t Address, MemoryRegion& OutRegion) const override;
+	const std::vector<MemoryImage>& GetImages() const override;
+	bool IsLive() const override;
+
+	bool IsReadable(uintptr_t Address, size_t Size = 1) const override;
+	MemoryReaderStats GetStats() const override;
+
+	void InvalidateCache() override;
+
+public:
+	/* Re-queries dyld for the list of loaded images. */
+	void RefreshImages();
+
+	/* Drops the region cache, it's rebuilt from the current VM map on the next check. Needed if the game unmapped memory since it was built. */
+	void RefreshRegionCache();
+
+private:
+	void BuildRegionCache() const;
+
+	enum class ECachedState
+	{
+		Unknown,
+		Readable,
+		Unreadable,
+	};
+
+	/* Looks 'Address' up in the cache, does not query the kernel. 'OutRegion' is the readable region if the result is Readable. */
+	ECachedState FindCachedRegion(uintptr_t Address, MemoryRegion& OutRegion) const;
+
+	/* Queries the kernel for the region containing 'Address' and adds it to the cache, as readable region or as hole. */
+	bool RefreshRegionAt(uintptr_t Address, MemoryRegion& OutRegion) const;
+};
+#endif
+
+/*
+* Offline process image, written on device by Memory::WriteSnapshot() and loaded with Memory::LoadSnapshot().
+*
+* File layout (little endian):
+*	SnapshotHeader
+*	SnapshotHeader::NumImages  x { uint64 HeaderAddress, int64 Slide, uint32 NameLength, char Name[NameLength] }
+*	SnapshotHeader::NumRegions x { uint64 Start, uint64 Size, uint32 Protection, uint32 Reserved, uint8 Data[Size] }
+*
+* Every region is mapped at its original address when loading, so the raw dereferences of the engine layer stay valid.
+*/
+class SnapshotMemoryReader : public MemoryReader
+{
+public:
+	struct SnapshotHeader
+	{
+		static constexpr uint64_t SnapshotMagic = 0x50414E5337443744; // "D7D7SNAP"
+		static constexpr uint32_t SnapshotVersion = 1;
+
+		uint64_t Magic = SnapshotMagic;
+		uint32_t Version = SnapshotVersion;
+		uint32_t NumImages = 0;
+		uint32_t NumRegions = 0;
+		uint32_t Reserved = 0;
+	};
+
+private:
+	std::vector<MemoryImage> Images;
+
+	/* Sorted by MemoryRegion::Start, non-overlapping */
+	std::vector<MemoryRegion> Regions;
+
+	/* Host mappings [Start, Size], unmapped on destruction */
+	std::vector<std::pair<uintptr_t, size_t>> Mappings;
+
+public:
+	SnapshotMemoryReader() = default;
+	~SnapshotMemoryReader() override;
+
+	SnapshotMemoryReader(const SnapshotMemoryReader&) = delete;
+	SnapshotMemoryReader& operator=(const SnapshotMemoryReader&) = delete;
+
+public:
+	bool Load(const fs::path& SnapshotPath);
+
+public:
+	bool Read(uintptr_t Address, void* OutBuffer, size_t Size) const override;
+	bool QueryRegion(uintptr_t Address, MemoryRegion& OutRegion) const override;
+	const std::vector<MemoryImage>& GetImages() const override;
+	bool IsLive() const override;
+
+private:
+	/* Maps the region at its original address and returns a writable pointer to it, or nullptr if the address range is taken. */
+	uint8_t* MapRegion(const MemoryRegion& Region);
+};
+
+namespace Memory
+{
+	/* The reader all engine accesses go through. Defaults to the live process on device. */
+	MemoryReader& GetReader();
+
+	void SetReader(std::unique_ptr<MemoryReader> NewReader);
+
+	inline bool IsLive()
+	{
+		return GetReader().IsLive();
+	}
+
+	/* Drops cached readability information of the current reader, called before every walk over GObjects. */
+	inline void InvalidateRegionCache()
+	{
+		GetReader().InvalidateCache();
+	}
+
+	/* Replaces the current reader with the snapshot at 'SnapshotPath'. */
+	bool LoadSnapshot(const fs::path& SnapshotPath);
+
+	/* Writes every readable, non-shared region of the current process to 'SnapshotPath'. Only available on a live reader. */
+	bool WriteSnapshot(const fs::path& SnapshotPath);
+}
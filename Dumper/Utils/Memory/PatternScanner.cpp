@@ -0,0 +1,389 @@
+#include <cctype>
+#include <cstdlib>
+#include <algorithm>
+
+#include "Memory/PatternScanner.h"
+#include "Memory/MemoryReader.h"
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace PatternScannerImpl
+{
+	constexpr size_t ChunkSize = 0x10;
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+	using ChunkType = uint8x16_t;
+
+	/* NEON has no movemask, narrowing the compare result leaves 4 bits per byte */
+	constexpr int32_t BitsPerByte = 4;
+
+	inline ChunkType LoadChunk(const uint8_t* Address)
+	{
+		return vld1q_u8(Address);
+	}
+
+	inline uint64_t CompareChunk(ChunkType Chunk, uint8_t Value)
+	{
+		const uint8x16_t Equal = vceqq_u8(Chunk, vdupq_n_u8(Value));
+		return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Equal), 4)), 0);
+	}
+#elif defined(__SSE2__)
+	using ChunkType = __m128i;
+
+	constexpr int32_t BitsPerByte = 1;
+
+	inline ChunkType LoadChunk(const uint8_t* Address)
+	{
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Address));
+	}
+
+	inline uint64_t CompareChunk(ChunkType Chunk, uint8_t Value)
+	{
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8(static_cast<char>(Value)))));
+	}
+#else
+	using ChunkType = const uint8_t*;
+
+	constexpr int32_t BitsPerByte = 1;
+
+	inline ChunkType LoadChunk(const uint8_t* Address)
+	{
+		return Address;
+	}
+
+	inline uint64_t CompareChunk(ChunkType Chunk, uint8_t Value)
+	{
+		uint64_t Mask = 0x0;
+
+		for (size_t i = 0; i < ChunkSize; i++)
+			Mask |= static_cast<uint64_t>(Chunk[i] == Value) << i;
+
+		return Mask;
+	}
+#endif
+
+	constexpr uint64_t ByteMatchMask = (1ull << BitsPerByte) - 1;
+
+	/*
+	* Rough commonness of a byte in ARM64 code. Instructions are little endian, so the top byte (opcode and usually the 'sf' bit) is the
+	* most repetitive one, register fields in the low bytes are spread out a lot more.
+	*/
+	inline int32_t GetByteCommonness(uint8_t Byte)
+	{
+		switch (Byte)
+		{
+		case 0x00:
+		case 0xFF:
+			return 4;
+		case 0xF9: // LDR/STR (64-bit)
+		case 0x91: // ADD (immediate)
+		case 0xAA: // MOV (register)
+		case 0xA9: // LDP/STP
+		case 0x94: // BL
+		case 0x97: // BL (backwards)
+		case 0x40:
+		case 0x03:
+			return 3;
+		case 0x90: // ADRP
+		case 0xB0:
+		case 0xD0:
+		case 0xF0:
+		case 0xB9: // LDR/STR (32-bit)
+		case 0x52: // MOV (wide)
+		case 0xD1: // SUB (immediate)
+		case 0xB4: // CBZ
+		case 0xB5: // CBNZ
+		case 0x54: // B.cond
+		case 0x14: // B
+		case 0x17:
+		case 0xD6: // BR/RET
+		case 0x1F:
+		case 0xE0:
+		case 0xE1:
+		case 0xE2:
+		case 0xF3:
+		case 0xF4:
+		case 0xFD:
+		case 0x7B:
+			return 2;
+		default:
+			return 1;
+		}
+	}
+}
+
+
+void CompiledPattern::SelectAnchor()
+{
+	AnchorIndex = -1;
+	int32_t LowestCommonness = INT32_MAX;
+
+	for (size_t i = 0; i < Values.size(); i++)
+	{
+		if (Masks[i] != 0xFF)
+			continue;
+
+		const int32_t Commonness = PatternScannerImpl::GetByteCommonness(Values[i]);
+
+		if (Commonness < LowestCommonness)
+		{
+			LowestCommonness = Commonness;
+			AnchorIndex = static_cast<int32_t>(i);
+		}
+	}
+}
+
+CompiledPattern CompiledPattern::FromSignature(const char* Signature)
+{
+	auto NibbleValue = [](char C) -> uint8_t
+	{
+		return static_cast<uint8_t>(isdigit(C) ? (C - '0') : (tolower(C) - 'a' + 0xA));
+	};
+
+	CompiledPattern Pattern;
+
+	const char* Current = Signature;
+	while (*Current)
+	{
+		const char High = Current[0];
+		const bool bIsHighNibble = High == '?' || isxdigit(High);
+
+		if (!bIsHighNibble)
+		{
+			Current++;
+			continue;
+		}
+
+		/* "?" and "F" are single-character tokens, "??", "F?", "?F" and "FF" two-character ones */
+		const char Low = Current[1];
+		const bool bHasLowNibble = Low == '?' || isxdigit(Low);
+
+		uint8_t Value = 0x0;
+		uint8_t Mask = 0x0;
+
+		if (!bHasLowNibble)
+		{
+			if (High != '?')
+			{
+				Value = NibbleValue(High);
+				Mask = 0xFF;
+			}
+
+			Current++;
+		}
+		else
+		{
+			if (High != '?')
+			{
+				Value |= NibbleValue(High) << 4;
+				Mask |= 0xF0;
+			}
+
+			if (Low != '?')
+			{
+				Value |= NibbleValue(Low);
+				Mask |= 0x0F;
+			}
+
+			Current += 2;
+		}
+
+		Pattern.Values.push_back(Value);
+		Pattern.Masks.push_back(Mask);
+	}
+
+	Pattern.SelectAnchor();
+	return Pattern;
+}
+
+CompiledPattern CompiledPattern::FromBytes(const std::vector<int>& Signature)
+{
+	CompiledPattern Pattern;
+	Pattern.Values.reserve(Signature.size());
+	Pattern.Masks.reserve(Signature.size());
+
+	for (const int Byte : Signature)
+	{
+		Pattern.Values.push_back(Byte == -1 ? 0x00 : static_cast<uint8_t>(Byte));
+		Pattern.Masks.push_back(Byte == -1 ? 0x00 : 0xFF);
+	}
+
+	Pattern.SelectAnchor();
+	return Pattern;
+}
+
+CompiledPattern CompiledPattern::FromRaw(const void* Bytes, size_t Length)
+{
+	const uint8_t* ByteArray = static_cast<const uint8_t*>(Bytes);
+
+	CompiledPattern Pattern;
+	Pattern.Values.assign(ByteArray, ByteArray + Length);
+	Pattern.Masks.assign(Length, 0xFF);
+
+	Pattern.SelectAnchor();
+	return Pattern;
+}
+
+
+PatternScanner::PatternScanner(const std::vector<const char*>& Signatures)
+{
+	for (const char* Signature : Signatures)
+		Add(Signature);
+}
+
+int32_t PatternScanner::Add(const char* Signature)
+{
+	return Add(CompiledPattern::FromSignature(Signature));
+}
+
+int32_t PatternScanner::Add(CompiledPattern&& Pattern)
+{
+	const int32_t Index = static_cast<int32_t>(Patterns.size());
+
+	if (Pattern.AnchorIndex == -1)
+	{
+		UnanchoredPatterns.push_back(Index);
+	}
+	else
+	{
+		const uint8_t AnchorValue = Pattern.Values[Pattern.AnchorIndex];
+
+		auto It = std::find_if(AnchorGroups.begin(), AnchorGroups.end(), [AnchorValue](const AnchorGroup& Group) { return Group.Value == AnchorValue; });
+
+		if (It != AnchorGroups.end())
+		{
+			It->PatternIndices.push_back(Index);
+		}
+		else
+		{
+			AnchorGroups.push_back({ AnchorValue, { Index } });
+		}
+	}
+
+	Patterns.push_back(std::move(Pattern));
+	return Index;
+}
+
+bool PatternScanner::ScanBlock(const uint8_t* BlockStart, const uint8_t* BlockEnd, int32_t MaxHitsPerPattern, std::vector<std::vector<uintptr_t>>& OutHits, size_t& InOutNumSatisfied) const
+{
+	using namespace PatternScannerImpl;
+
+	/* Returns true once every pattern has all of its hits */
+	auto TryMatch = [&](int32_t PatternIndex, const uint8_t* Candidate) -> bool
+	{
+		const CompiledPattern& Pattern = Patterns[PatternIndex];
+		std::vector<uintptr_t>& Hits = OutHits[PatternIndex];
+
+		if (MaxHitsPerPattern >= 0 && Hits.size() >= static_cast<size_t>(MaxHitsPerPattern))
+			return false;
+
+		if (Candidate < BlockStart || Candidate + Pattern.Size() > BlockEnd || !Pattern.Matches(Candidate))
+			return false;
+
+		Hits.push_back(reinterpret_cast<uintptr_t>(Candidate));
+
+		if (MaxHitsPerPattern >= 0 && Hits.size() == static_cast<size_t>(MaxHitsPerPattern))
+			InOutNumSatisfied++;
+
+		return InOutNumSatisfied == Patterns.size();
+	};
+
+	auto TryAnchorHit = [&](const AnchorGroup& Group, const uint8_t* AnchorAddress) -> bool
+	{
+		for (const int32_t PatternIndex : Group.PatternIndices)
+		{
+			if (TryMatch(PatternIndex, AnchorAddress - Patterns[PatternIndex].AnchorIndex))
+				return true;
+		}
+
+		return false;
+	};
+
+	/* Patterns made up only of wildcards don't have an anchor, there's no way around checking them at every position */
+	for (const int32_t PatternIndex : UnanchoredPatterns)
+	{
+		for (const uint8_t* Curr = BlockStart; Curr < BlockEnd; Curr++)
+		{
+			if (TryMatch(PatternIndex, Curr))
+				return true;
+		}
+	}
+
+	if (AnchorGroups.empty())
+		return false;
+
+	const uint8_t* Curr = BlockStart;
+
+	for (; Curr + ChunkSize <= BlockEnd; Curr += ChunkSize)
+	{
+		const ChunkType Chunk = LoadChunk(Curr);
+
+		for (const AnchorGroup& Group : AnchorGroups)
+		{
+			uint64_t Mask = CompareChunk(Chunk, Group.Value);
+
+			while (Mask != 0x0)
+			{
+				const int32_t ByteIndex = __builtin_ctzll(Mask) / BitsPerByte;
+				Mask &= ~(ByteMatchMask << (ByteIndex * BitsPerByte));
+
+				if (TryAnchorHit(Group, Curr + ByteIndex))
+					return true;
+			}
+		}
+	}
+
+	/* Tail that doesn't fill a whole chunk */
+	for (; Curr < BlockEnd; Curr++)
+	{
+		for (const AnchorGroup& Group : AnchorGroups)
+		{
+			if (*Curr == Group.Value && TryAnchorHit(Group, Curr))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+std::vector<std::vector<uintptr_t>> PatternScanner::Scan(const uint8_t* Start, uintptr_t Range, int32_t MaxHitsPerPattern) const
+{
+	std::vector<std::vector<uintptr_t>> Hits(Patterns.size());
+
+	if (Patterns.empty() || MaxHitsPerPattern == 0)
+		return Hits;
+
+	size_t NumSatisfied = 0x0;
+
+	const uint8_t* End = Start + Range;
+	const uint8_t* Curr = Start;
+
+	/* Only scan readable memory, a pattern spanning two regions is not found */
+	while (Curr < End)
+	{
+		MemoryRegion Region;
+
+		if (!Memory::GetReader().QueryRegion(reinterpret_cast<uintptr_t>(Curr), Region) || Region.Start >= reinterpret_cast<uintptr_t>(End))
+			break;
+
+		if (!Region.Contains(reinterpret_cast<uintptr_t>(Curr)))
+		{
+			Curr = reinterpret_cast<const uint8_t*>(Region.Start);
+			continue;
+		}
+
+		const uint8_t* BlockEnd = reinterpret_cast<const uint8_t*>(std::min(Region.End(), reinterpret_cast<uintptr_t>(End)));
+
+		if (ScanBlock(Curr, BlockEnd, MaxHitsPerPattern, Hits, NumSatisfied))
+			break;
+
+		Curr = BlockEnd;
+	}
+
+	return Hits;
+}
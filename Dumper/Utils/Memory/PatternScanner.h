@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+/*
+* Signature compiled into a value and a mask per byte, so a byte matches if '(Byte & Mask) == Value'.
+*
+* Accepts IDA-style signatures: "48 8B ? ? F?" where '?'/'??' is a full wildcard and 'F?'/'?F' only matches one nibble.
+*/
+struct CompiledPattern
+{
+	std::vector<uint8_t> Values;
+	std::vector<uint8_t> Masks;
+
+	/* Index of the least common, fully specified byte, which is searched for first. -1 if every byte is (partially) wildcarded. */
+	int32_t AnchorIndex = -1;
+
+public:
+	static CompiledPattern FromSignature(const char* Signature);
+
+	/* Legacy byte-vector form, -1 is a full wildcard */
+	static CompiledPattern FromBytes(const std::vector<int>& Signature);
+
+	/* Exact byte sequence, no wildcards */
+	static CompiledPattern FromRaw(const void* Bytes, size_t Length);
+
+public:
+	inline size_t Size() const { return Values.size(); }
+
+	inline bool Matches(const uint8_t* Address) const
+	{
+		for (size_t i = 0; i < Values.size(); i++)
+		{
+			if ((Address[i] & Masks[i]) != Values[i])
+				return false;
+		}
+
+		return true;
+	}
+
+private:
+	void SelectAnchor();
+};
+
+/*
+* Finds any number of signatures in a single pass over a range.
+*
+* Every pattern is anchored on its rarest fixed byte. Each 16-byte chunk of the range is compared against all distinct anchor bytes
+* with NEON (or SSE2 on x86 hosts) and only positions where an anchor matched are verified against the full pattern.
+*/
+class PatternScanner
+{
+private:
+	struct AnchorGroup
+	{
+		uint8_t Value;
+		std::vector<int32_t> PatternIndices;
+	};
+
+private:
+	std::vector<CompiledPattern> Patterns;
+
+	/* Patterns grouped by their anchor byte, rebuilt in Add() */
+	std::vector<AnchorGroup> AnchorGroups;
+
+	/* Patterns without a fixed byte, checked at every position */
+	std::vector<int32_t> UnanchoredPatterns;
+
+public:
+	PatternScanner() = default;
+
+	PatternScanner(const std::vector<const char*>& Signatures);
+
+public:
+	/* Returns the index of the pattern in the result of Scan() */
+	int32_t Add(const char* Signature);
+	int32_t Add(CompiledPattern&& Pattern);
+
+	inline size_t Num() const { return Patterns.size(); }
+
+public:
+	/*
+	* Scans all readable memory in [Start, Start + Range) and returns, per pattern, the addresses of its matches in ascending order.
+	*
+	* Scanning stops early once every pattern has 'MaxHitsPerPattern' matches, pass -1 to find all of them.
+	*/
+	std::vector<std::vector<uintptr_t>> Scan(const uint8_t* Start, uintptr_t Range, int32_t MaxHitsPerPattern = -1) const;
+
+private:
+	/* Scans one readable block, returns true once every pattern is satisfied */
+	bool ScanBlock(const uint8_t* BlockStart, const uint8_t* BlockEnd, int32_t MaxHitsPerPattern, std::vector<std::vector<uintptr_t>>& OutHits, size_t& InOutNumSatisfied) const;
+};
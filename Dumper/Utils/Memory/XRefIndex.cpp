@@ -0,0 +1,139 @@
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+#include "Memory/XRefIndex.h"
+#include "Utils.h"
+#include "Menu/Logger.h"
+
+
+void XRefIndex::Build()
+{
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	const auto [Base, Size, Header] = GetImageBaseAndSize();
+	const auto [Text, TextSize] = GetSegmentByName(Header, "__TEXT");
+
+	XRefs.clear();
+	ImageBase = Base;
+	TextStart = Text;
+	TextEnd = Text;
+
+	if (!Text || TextSize < 0x8)
+		return;
+
+	TextEnd = Text + TextSize;
+
+	const uintptr_t ImageEnd = Base + Size;
+
+	/* Decodes [ChunkStart, ChunkEnd) into 'OutRefs', the second instruction of a pair may be in the next chunk */
+	auto DecodeChunk = [Text, TextSize, Base, ImageEnd](uintptr_t ChunkStart, uintptr_t ChunkEnd, std::vector<XRef>& OutRefs) -> void
+	{
+		const uintptr_t LastInstruction = Text + TextSize - 0x8;
+
+		for (uintptr_t Site = ChunkStart; Site < ChunkEnd && Site <= LastInstruction; Site += 0x4)
+		{
+			const uint32_t Instruction = *reinterpret_cast<const uint32_t*>(Site);
+
+			if (!ASMUtils::IsADRP(Instruction))
+				continue;
+
+			const uint32_t NextInstruction = *reinterpret_cast<const uint32_t*>(Site + 0x4);
+
+			uintptr_t Target = 0x0;
+			EXRefKind Kind = EXRefKind::ADRL;
+
+			if (ASMUtils::IsADRL(Site))
+			{
+				Target = ASMUtils::ResolveADRL(Site);
+				Kind = EXRefKind::ADRL;
+			}
+			else if ((NextInstruction & 0xFFC00000) == 0xF9400000 && ((NextInstruction >> 5) & 0x1F) == (Instruction & 0x1F))
+			{
+				Target = ASMUtils::ResolveADRP_LDR(Site);
+				Kind = EXRefKind::ADRP_LDR;
+			}
+
+			if (Target < Base || Target >= ImageEnd)
+				continue;
+
+			OutRefs.push_back({ Target, static_cast<uint32_t>(Site - Text), Kind });
+		}
+	};
+
+	const uint32_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+	const uintptr_t ChunkSize = ((TextSize / NumThreads) + 0x3) & ~0x3ull;
+
+	std::vector<std::vector<XRef>> ChunkRefs(NumThreads);
+	std::vector<std::thread> Workers;
+	Workers.reserve(NumThreads);
+
+	for (uint32_t i = 0; i < NumThreads; i++)
+	{
+		const uintptr_t ChunkStart = Text + (i * ChunkSize);
+		const uintptr_t ChunkEnd = (i == NumThreads - 1) ? (Text + TextSize) : (ChunkStart + ChunkSize);
+
+		Workers.emplace_back(DecodeChunk, ChunkStart, ChunkEnd, std::ref(ChunkRefs[i]));
+	}
+
+	size_t NumRefs = 0x0;
+	for (uint32_t i = 0; i < NumThreads; i++)
+	{
+		Workers[i].join();
+		NumRefs += ChunkRefs[i].size();
+	}
+
+	XRefs.reserve(NumRefs);
+	for (const std::vector<XRef>& Refs : ChunkRefs)
+		XRefs.insert(XRefs.end(), Refs.begin(), Refs.end());
+
+	/* Chunks are already ordered by site, a stable sort by target keeps sites ascending per target */
+	std::stable_sort(XRefs.begin(), XRefs.end(), [](const XRef& Left, const XRef& Right) { return Left.Target < Right.Target; });
+
+	const auto EndTime = std::chrono::high_resolution_clock::now();
+	const auto Duration = std::chrono::duration_cast<std::chrono::milliseconds>(EndTime - StartTime);
+
+	LogInfo("Built xref index: %zu references in __TEXT (%d threads, %lldms)", XRefs.size(), NumThreads, static_cast<long long>(Duration.count()));
+}
+
+bool XRefIndex::Init()
+{
+	std::scoped_lock Lock(BuildLock);
+
+	const uintptr_t CurrentImageBase = GetImageBaseAndSize().Base;
+
+	if (!bIsBuilt || ImageBase != CurrentImageBase)
+	{
+		Build();
+		bIsBuilt = true;
+	}
+
+	return !XRefs.empty();
+}
+
+std::pair<const XRef*, const XRef*> XRefIndex::GetXRefsTo(uintptr_t Target)
+{
+	if (!Init())
+		return { nullptr, nullptr };
+
+	auto First = std::lower_bound(XRefs.cbegin(), XRefs.cend(), Target, [](const XRef& Ref, uintptr_t Value) { return Ref.Target < Value; });
+	auto Last = std::upper_bound(First, XRefs.cend(), Target, [](uintptr_t Value, const XRef& Ref) { return Value < Ref.Target; });
+
+	return { XRefs.data() + (First - XRefs.cbegin()), XRefs.data() + (Last - XRefs.cbegin()) };
+}
+
+uintptr_t XRefIndex::FindFirstXRefTo(uintptr_t Target, EXRefKind Kind, uintptr_t MinSite, uintptr_t MaxSite)
+{
+	const auto [First, Last] = GetXRefsTo(Target);
+
+	/* Sites are sorted per target */
+	for (const XRef* Ref = First; Ref != Last; Ref++)
+	{
+		const uintptr_t Site = GetSite(*Ref);
+
+		if (Ref->Kind == Kind && Site >= MinSite && Site < MaxSite)
+			return Site;
+	}
+
+	return 0x0;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+enum class EXRefKind : uint8_t
+{
+	ADRL,     // ADRP + ADD, loads an address
+	ADRP_LDR, // ADRP + LDR (64-bit), loads a value from an address
+};
+
+struct XRef
+{
+	uintptr_t Target;
+	uint32_t SiteOffset; // Offset of the ADRP from XRefIndex::GetTextStart()
+	EXRefKind Kind;
+};
+
+/*
+* Every ADRP+ADD and ADRP+LDR pair in the __TEXT segment of the main image, sorted by target address.
+*
+* Built lazily with one parallel decode of __TEXT on the first lookup. Only references to targets inside of the main image are kept,
+* which is everything the string lookups in Utils.h care about.
+*/
+class XRefIndex
+{
+private:
+	static inline std::mutex BuildLock;
+
+	/* Sorted by (Target, SiteOffset) */
+	static inline std::vector<XRef> XRefs;
+
+	static inline uintptr_t TextStart = 0x0;
+	static inline uintptr_t TextEnd = 0x0;
+	static inline uintptr_t ImageBase = 0x0;
+
+	static inline bool bIsBuilt = false;
+
+private:
+	static void Build();
+
+public:
+	/* Builds the index if needed, rebuilds it if the main image changed (eg. a process snapshot was loaded) */
+	static bool Init();
+
+	static inline uintptr_t GetTextStart() { return TextStart; }
+
+	/* End of the range covered by the index, equal to GetTextStart() if there is no __TEXT segment */
+	static inline uintptr_t GetTextEnd() { return TextEnd; }
+
+	static inline uintptr_t GetSite(const XRef& Ref) { return TextStart + Ref.SiteOffset; }
+
+public:
+	/* Range [First, Last) of all references to exactly 'Target' */
+	static std::pair<const XRef*, const XRef*> GetXRefsTo(uintptr_t Target);
+
+	/* Lowest site in [MinSite, MaxSite) referencing 'Target', or 0x0 */
+	static uintptr_t FindFirstXRefTo(uintptr_t Target, EXRefKind Kind = EXRefKind::ADRL, uintptr_t MinSite = 0x0, uintptr_t MaxSite = UINTPTR_MAX);
+
+	/* Lowest site in [MinSite, MaxSite) referencing any target for which 'IsWantedTarget(Target)' is true, or 0x0 */
+	template<typename PredicateType>
+	static uintptr_t FindFirstXRefTo(PredicateType&& IsWantedTarget, EXRefKind Kind = EXRefKind::ADRL, uintptr_t MinSite = 0x0, uintptr_t MaxSite = UINTPTR_MAX)
+	{
+		if (!Init())
+			return 0x0;
+
+		uintptr_t LowestSite = 0x0;
+
+		for (auto It = XRefs.cbegin(); It != XRefs.cend();)
+		{
+			const uintptr_t Target = It->Target;
+
+			/* Predicate is only called once per unique target */
+			const bool bIsWanted = IsWantedTarget(Target);
+
+			for (; It != XRefs.cend() && It->Target == Target; ++It)
+			{
+				if (!bIsWanted || It->Kind != Kind)
+					continue;
+
+				const uintptr_t Site = GetSite(*It);
+
+				if (Site >= MinSite && Site < MaxSite && (LowestSite == 0x0 || Site < LowestSite))
+					LowestSite = Site;
+			}
+		}
+
+		return LowestSite;
+	}
+};
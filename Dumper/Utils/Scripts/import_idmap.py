@@ -1,18 +1,65 @@
 import struct
+import mmap
 import os
 import ida_kernwin
 import ida_nalt
 import ida_name
 import ida_idaapi
 
+# Binary index written with Settings::IDAMappingGenerator::bGenerateBinaryIndex
+IDMAPIDX_MAGIC = b"D7IX"
+IDMAPIDX_HEADER = struct.Struct("<4sIII")  # Magic, Version, NumEntries, StringBlobSize
+IDMAPIDX_ENTRY = struct.Struct("<III")     # Offset, NameOffset, NameLength
+
+IDMAP_OFFSET = struct.Struct("<I")
+IDMAP_NAME_LENGTH = struct.Struct("<H")
+
+def decode_name(name_bytes):
+    try:
+        return name_bytes.decode('utf-8')
+    except UnicodeDecodeError:
+        return name_bytes.decode('latin-1', errors='replace')
+
+def iterate_idmapidx(data):
+    magic, version, num_entries, blob_size = IDMAPIDX_HEADER.unpack_from(data, 0)
+    if magic != IDMAPIDX_MAGIC:
+        raise ValueError("Not a .idmapidx file")
+    if version != 1:
+        raise ValueError(f"Unsupported .idmapidx version {version}")
+
+    entries_start = IDMAPIDX_HEADER.size
+    blob_start = entries_start + num_entries * IDMAPIDX_ENTRY.size
+
+    if blob_start + blob_size > len(data):
+        raise ValueError("Truncated .idmapidx file")
+
+    for i in range(num_entries):
+        offset, name_offset, name_len = IDMAPIDX_ENTRY.unpack_from(data, entries_start + i * IDMAPIDX_ENTRY.size)
+        name_start = blob_start + name_offset
+        yield offset, data[name_start:name_start + name_len]
+
+def iterate_idmap(data):
+    pos = 0
+    file_size = len(data)
+
+    while pos + IDMAP_OFFSET.size + IDMAP_NAME_LENGTH.size <= file_size:
+        offset = IDMAP_OFFSET.unpack_from(data, pos)[0]
+        name_len = IDMAP_NAME_LENGTH.unpack_from(data, pos + IDMAP_OFFSET.size)[0]
+        pos += IDMAP_OFFSET.size + IDMAP_NAME_LENGTH.size
+
+        if pos + name_len > file_size: break
+
+        yield offset, data[pos:pos + name_len]
+        pos += name_len
+
 def import_functions():
-    file_path = ida_kernwin.ask_file(0, "*.idmap", "Load the .idmap file")
+    file_path = ida_kernwin.ask_file(0, "*.idmap;*.idmapidx", "Load the .idmap or .idmapidx file")
     if not file_path:
         print("IDAExecFunctionsImporter: Cancelled by user.")
         return
 
     print(f"IDAExecFunctionsImporter: Processing {file_path}...")
-    
+
     image_base = ida_nalt.get_imagebase()
     print(f"IDAExecFunctionsImporter: Image base is 0x{image_base:X}")
     print("IDAExecFunctionsImporter: Applying names...")
@@ -20,31 +67,17 @@ def import_functions():
     count = 0
     try:
         with open(file_path, "rb") as f:
-            f.seek(0, os.SEEK_END)
-            file_size = f.tell()
-            f.seek(0, os.SEEK_SET)
-
-            while f.tell() < file_size:
-                offset_data = f.read(4)
-                if len(offset_data) < 4: break
-                offset = struct.unpack("<I", offset_data)[0]
-
-                len_data = f.read(2)
-                if len(len_data) < 2: break
-                name_len = struct.unpack("<H", len_data)[0]
-
-                name_bytes = f.read(name_len)
-                if len(name_bytes) < name_len: break
-                
-                try:
-                    name = name_bytes.decode('utf-8')
-                except UnicodeDecodeError:
-                    name = name_bytes.decode('latin-1', errors='replace')
-
-                ea = image_base + offset
-                ida_name.set_name(ea, name)
-                
-                count += 1
+            if os.fstat(f.fileno()).st_size == 0:
+                print("IDAExecFunctionsImporter: File is empty.")
+                return
+
+            with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as data:
+                is_index = file_path.lower().endswith(".idmapidx")
+                records = iterate_idmapidx(data) if is_index else iterate_idmap(data)
+
+                for offset, name_bytes in records:
+                    ida_name.set_name(image_base + offset, decode_name(name_bytes))
+                    count += 1
 
     except Exception as e:
         print(f"IDAExecFunctionsImporter: Error reading file: {e}")
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <array>
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -8,13 +9,13 @@
 #include <tuple>
 #include <cmath>
 #include <type_traits>
+#include <cstring>
 
-#include <mach/mach.h>
-#include <mach-o/dyld.h>
-#include <mach-o/loader.h>
-#include <mach-o/getsect.h>
 #include <dlfcn.h>
 #include "Settings.h"
+#include "Memory/MemoryReader.h"
+#include "Memory/PatternScanner.h"
+#include "Memory/XRefIndex.h"
 
 /* Credits: https://en.cppreference.com/w/cpp/string/byte/tolower */
 inline std::string str_tolower(std::string S)
@@ -203,13 +204,11 @@ struct MachImageInfo {
 
 inline MachImageInfo GetImageBaseAndSize(const char* ImageName = nullptr)
 {
-    uint32_t Count = _dyld_image_count();
-    for (uint32_t i = 0; i < Count; i++)
+    for (const MemoryImage& Image : Memory::GetReader().GetImages())
     {
-        const char* Name = _dyld_get_image_name(i);
-        if (!ImageName || strstr(Name, ImageName))
+        if (!ImageName || strstr(Image.Name.c_str(), ImageName))
         {
-            const auto* Header = (const struct mach_header_64*)_dyld_get_image_header(i);
+            const auto* Header = (const struct mach_header_64*)Image.HeaderAddress;
             
             // Calculate real image size by iterating segments
             uintptr_t MinAddr = ~0UL;
@@ -233,7 +232,10 @@ inline MachImageInfo GetImageBaseAndSize(const char* ImageName = nullptr)
 
 inline uintptr_t GetModuleBase(const char* SearchModuleName = nullptr) {
     if (SearchModuleName == nullptr)
-        return (uintptr_t)_dyld_get_image_header(0);
+    {
+        const auto& Images = Memory::GetReader().GetImages();
+        return !Images.empty() ? Images[0].HeaderAddress : 0x0;
+    }
 
     return GetImageBaseAndSize(SearchModuleName).Base;
 }
@@ -257,10 +259,9 @@ inline std::pair<uintptr_t, size_t> GetSegmentByName(const struct mach_header_64
             {
                 intptr_t Slide = 0;
                 // Calculate ASLR Slide
-                uint32_t Count = _dyld_image_count();
-                for (uint32_t j = 0; j < Count; j++) {
-                    if ((const struct mach_header_64*)_dyld_get_image_header(j) == Header) {
-                        Slide = _dyld_get_image_vmaddr_slide(j);
+                for (const MemoryImage& Image : Memory::GetReader().GetImages()) {
+                    if ((const struct mach_header_64*)Image.HeaderAddress == Header) {
+                        Slide = Image.Slide;
                         break;
                     }
                 }
@@ -272,6 +273,26 @@ inline std::pair<uintptr_t, size_t> GetSegmentByName(const struct mach_header_64
     return { 0, 0 };
 }
 
+inline bool GetImageUUID(const struct mach_header_64* Header, uint8_t(&OutUUID)[16])
+{
+    if (!Header) return false;
+
+    uintptr_t CommandPtr = (uintptr_t)(Header + 1);
+
+    for (uint32_t i = 0; i < Header->ncmds; ++i)
+    {
+        const struct load_command* LC = (const struct load_command*)CommandPtr;
+
+        if (LC->cmd == LC_UUID)
+        {
+            memcpy(OutUUID, ((const struct uuid_command*)LC)->uuid, sizeof(OutUUID));
+            return true;
+        }
+        CommandPtr += LC->cmdsize;
+    }
+    return false;
+}
+
 inline uintptr_t GetOffset(const uintptr_t Address)
 {
     static uintptr_t ImageBase = 0x0;
@@ -289,9 +310,8 @@ inline uintptr_t GetOffset(const void* Address)
 
 inline bool IsInAnyModules(const uintptr_t Address) {
     // Basic check to see if address is inside the header of any loaded image
-    uint32_t Count = _dyld_image_count();
-    for (uint32_t i = 0; i < Count; i++) {
-        if ((uintptr_t)_dyld_get_image_header(i) == Address) return true;
+    for (const MemoryImage& Image : Memory::GetReader().GetImages()) {
+        if (Image.HeaderAddress == Address) return true;
     }
     return false;
 }
@@ -300,23 +320,13 @@ template <typename T>
 inline T SafeRead(uintptr_t Address, T Default = {})
 {
     T Buffer = Default;
-    vm_size_t Size = 0;
-    // Uses the same API as your IsBadReadPtr
-    kern_return_t KR = vm_read_overwrite(mach_task_self(), (vm_address_t)Address, sizeof(T), (vm_address_t)&Buffer, &Size);
-    if (KR != KERN_SUCCESS || Size != sizeof(T)) return Default;
+    if (!Memory::GetReader().Read(Address, &Buffer, sizeof(T))) return Default;
     return Buffer;
 }
 
 inline bool IsBadReadPtr(const void* Ptr)
 {
-    uint8_t Data = 0;
-    size_t Size = 0;
-    
-    kern_return_t KR = vm_read_overwrite(mach_task_self(), (vm_address_t)Ptr, 1, (vm_address_t)&Data, &Size);
-    return (KR == KERN_INVALID_ADDRESS ||
-            KR == KERN_MEMORY_FAILURE  ||
-            KR == KERN_MEMORY_ERROR    ||
-            KR == KERN_PROTECTION_FAILURE);
+    return !Memory::GetReader().IsReadable(reinterpret_cast<uintptr_t>(Ptr));
 };
 
 inline bool IsBadReadPtr(const uintptr_t Ptr)
@@ -352,127 +362,48 @@ inline void* GetModuleAddress(const char* SearchModuleName)
     return nullptr;
 }
 
-inline void* FindPatternInRange(const void* Pattern, size_t PatternLen, const uint8_t* Start, uintptr_t Range)
+inline void* FindPatternInRange(const CompiledPattern& Pattern, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0, int SkipCount = 0)
 {
-    const uint8_t* PatBytes = static_cast<const uint8_t*>(Pattern);
-    const uint8_t* End = Start + Range;
-    const uint8_t* Curr = Start;
+    PatternScanner Scanner;
+    Scanner.Add(CompiledPattern(Pattern));
 
-    while (Curr <= (End - PatternLen))
-    {
-        vm_size_t VmSize = 0;
-        vm_address_t VmAddr = (vm_address_t)Curr;
-        vm_region_basic_info_data_64_t Info;
-        mach_msg_type_number_t Count = VM_REGION_BASIC_INFO_COUNT_64;
-        memory_object_name_t Obj;
-        
-        // Safety Check: Ask Kernel if this address is readable
-        kern_return_t Kr = vm_region_64(mach_task_self(), &VmAddr, &VmSize, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&Info, &Count, &Obj);
-        
-        if (Kr != KERN_SUCCESS || !(Info.protection & VM_PROT_READ)) {
-            // Bad memory: Skip this whole block
-            Curr = (const uint8_t*)(VmAddr + VmSize);
-            continue;
-        }
+    const auto Hits = Scanner.Scan(Start, Range, SkipCount + 1);
 
-        // Calculate the safe end for this specific valid block
-        uintptr_t BlockEndPtr = (uintptr_t)VmAddr + VmSize;
-        if (BlockEndPtr > (uintptr_t)End) BlockEndPtr = (uintptr_t)End;
-        const uint8_t* BlockEnd = (const uint8_t*)BlockEndPtr;
+    if (Hits[0].size() <= static_cast<size_t>(SkipCount))
+        return nullptr;
 
-        // Fast Loop: Scan inside the valid block
-        for (; Curr <= (BlockEnd - PatternLen); ++Curr)
-        {
-            if (memcmp(Curr, PatBytes, PatternLen) == 0)
-            {
-                return const_cast<void*>(static_cast<const void*>(Curr));
-            }
-        }
-    }
-    return nullptr;
+    uintptr_t Address = Hits[0][SkipCount];
+    if (bRelative) Address = Address + Offset;
+    return reinterpret_cast<void*>(Address);
 }
 
-inline void* FindPatternInRange(const std::vector<int>& Signature, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0, int SkipCount = 0)
+inline void* FindPatternInRange(const void* Pattern, size_t PatternLen, const uint8_t* Start, uintptr_t Range)
 {
-    const auto PatternLength = Signature.size();
-    const auto PatternBytes = Signature.data();
-    const uint8_t* End = Start + Range;
-    const uint8_t* Curr = Start;
-
-    // Outer Loop: Jump between valid memory regions
-    while (Curr <= (End - PatternLength))
-    {
-        vm_size_t VmSize = 0;
-        vm_address_t VmAddr = (vm_address_t)Curr;
-        vm_region_basic_info_data_64_t Info;
-        mach_msg_type_number_t Count = VM_REGION_BASIC_INFO_COUNT_64;
-        memory_object_name_t Obj;
-        
-        // Safety Check
-        kern_return_t Kr = vm_region_64(mach_task_self(), &VmAddr, &VmSize, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&Info, &Count, &Obj);
-        
-        if (Kr != KERN_SUCCESS || !(Info.protection & VM_PROT_READ)) {
-            Curr = (const uint8_t*)(VmAddr + VmSize);
-            continue;
-        }
-
-        uintptr_t BlockEndPtr = (uintptr_t)VmAddr + VmSize;
-        if (BlockEndPtr > (uintptr_t)End) BlockEndPtr = (uintptr_t)End;
-        const uint8_t* BlockEnd = (const uint8_t*)BlockEndPtr;
-
-        // Fast Loop
-        for (; Curr <= (BlockEnd - PatternLength); ++Curr)
-        {
-            bool bFound = true;
-            for (size_t j = 0; j < PatternLength; ++j)
-            {
-                if (Curr[j] != PatternBytes[j] && PatternBytes[j] != -1)
-                {
-                    bFound = false;
-                    break;
-                }
-            }
-
-            if (bFound)
-            {
-                if (SkipCount > 0) {
-                    SkipCount--;
-                    continue;
-                }
+    return FindPatternInRange(CompiledPattern::FromRaw(Pattern, PatternLen), Start, Range);
+}
 
-                uintptr_t Address = reinterpret_cast<uintptr_t>(Curr);
-                if (bRelative) Address = Address + Offset;
-                return reinterpret_cast<void*>(Address);
-            }
-        }
-    }
-    return nullptr;
+inline void* FindPatternInRange(const std::vector<int>& Signature, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0, int SkipCount = 0)
+{
+    return FindPatternInRange(CompiledPattern::FromBytes(Signature), Start, Range, bRelative, Offset, SkipCount);
 }
 
 inline void* FindPatternInRange(const char* Signature, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0)
 {
-    static auto patternToByte = [](const char* pattern) -> std::vector<int>
-    {
-        auto Bytes = std::vector<int>{};
-        const char* Current = pattern;
+    return FindPatternInRange(CompiledPattern::FromSignature(Signature), Start, Range, bRelative, Offset);
+}
 
-        while (*Current)
-        {
-            if (*Current == '?') {
-                ++Current;
-                if (*Current == '?') ++Current;
-                Bytes.push_back(-1);
-            } else if (isxdigit(*Current)) {
-                Bytes.push_back(strtoul(Current, const_cast<char**>(&Current), 16));
-            } else {
-                ++Current;
-            }
-        }
-        return Bytes;
-    };
-    
-    std::vector<int> Bytes = patternToByte(Signature);
-    return FindPatternInRange(Bytes, Start, Range, bRelative, Offset);
+/* Finds all signatures in one pass, returns the first match of every signature or nullptr */
+inline std::vector<void*> FindPatternsInRange(const std::vector<const char*>& Signatures, const uint8_t* Start, uintptr_t Range)
+{
+    const auto Hits = PatternScanner(Signatures).Scan(Start, Range, 1);
+
+    std::vector<void*> Results;
+    Results.reserve(Hits.size());
+
+    for (const auto& PatternHits : Hits)
+        Results.push_back(!PatternHits.empty() ? reinterpret_cast<void*>(PatternHits[0]) : nullptr);
+
+    return Results;
 }
 
 inline void* FindPattern(const char* Signature, const char* SegmentName = "__TEXT", uint32_t Offset = 0, uintptr_t StartAddress = 0x0)
@@ -509,6 +440,27 @@ inline void* FindPattern(const char* Signature, const char* SegmentName = "__TEX
     return FindPatternInRange(Signature, reinterpret_cast<uint8_t*>(SearchStart), SearchRange, Offset != 0, Offset);
 }
 
+/* Single-pass version of FindPattern for several signatures, returns the first match of every signature or nullptr */
+inline std::vector<void*> FindPatterns(const std::vector<const char*>& Signatures, const char* SegmentName = "__TEXT")
+{
+    const auto [ImageBase, ImageSize, Header] = GetImageBaseAndSize();
+
+    uintptr_t SearchStart = ImageBase;
+    uintptr_t SearchRange = ImageSize;
+
+    if (SegmentName != nullptr)
+    {
+        const auto [SegStart, SegSize] = GetSegmentByName(Header, SegmentName);
+        if (SegStart == 0 || SegSize == 0)
+            return std::vector<void*>(Signatures.size(), nullptr);
+
+        SearchStart = SegStart;
+        SearchRange = SegSize;
+    }
+
+    return FindPatternsInRange(Signatures, reinterpret_cast<uint8_t*>(SearchStart), SearchRange);
+}
+
 template<typename T>
 inline T* FindAlignedValueInProcessInRange(T Value, int32_t Alignment, uintptr_t StartAddress, uint32_t Range)
 {
@@ -548,6 +500,102 @@ inline T* FindAlignedValueInProcess(T Value, const std::string& Sectionname = "_
     return Result;
 }
 
+/* Every segment whose name starts with 'SegmentPrefix', eg. "__DATA" for __DATA, __DATA_CONST and __DATA_DIRTY */
+inline std::vector<std::pair<uintptr_t, size_t>> GetSegmentsByPrefix(const struct mach_header_64* Header, const char* SegmentPrefix)
+{
+    std::vector<std::pair<uintptr_t, size_t>> Segments;
+
+    if (!Header || !SegmentPrefix)
+        return Segments;
+
+    intptr_t Slide = 0;
+    for (const MemoryImage& Image : Memory::GetReader().GetImages()) {
+        if ((const struct mach_header_64*)Image.HeaderAddress == Header) {
+            Slide = Image.Slide;
+            break;
+        }
+    }
+
+    const size_t PrefixLength = strlen(SegmentPrefix);
+    uintptr_t CommandPtr = (uintptr_t)(Header + 1);
+
+    for (uint32_t i = 0; i < Header->ncmds; ++i)
+    {
+        const struct load_command* LC = (const struct load_command*)CommandPtr;
+
+        if (LC->cmd == LC_SEGMENT_64)
+        {
+            const struct segment_command_64* Seg = (const struct segment_command_64*)LC;
+
+            if (strncmp(Seg->segname, SegmentPrefix, PrefixLength) == 0 && Seg->vmsize != 0)
+                Segments.emplace_back(Seg->vmaddr + Slide, Seg->vmsize);
+        }
+        CommandPtr += LC->cmdsize;
+    }
+
+    return Segments;
+}
+
+struct AlignedPointerHit
+{
+    uintptr_t Address; // Where the pointer is stored
+    uintptr_t Value;   // Which of the searched pointers it is
+};
+
+/*
+* Appends every 8-byte aligned slot in [StartAddress, StartAddress + Range) holding one of 'SortedValues'.
+*
+* A single unsigned compare against the range of all values rejects almost every slot, so the loop stays branch-predictable and
+* vectorizable. Only slots inside of that range are looked up in 'SortedValues'.
+*/
+inline void FindAlignedPointersInRange(const std::vector<uintptr_t>& SortedValues, uintptr_t StartAddress, size_t Range, std::vector<AlignedPointerHit>& OutHits)
+{
+    if (SortedValues.empty())
+        return;
+
+    const uintptr_t MinValue = SortedValues.front();
+    const uintptr_t ValueSpan = SortedValues.back() - MinValue;
+
+    const uintptr_t* Slots = reinterpret_cast<const uintptr_t*>((StartAddress + 0x7) & ~0x7ull);
+    const size_t NumSlots = (StartAddress + Range - reinterpret_cast<uintptr_t>(Slots)) / sizeof(uintptr_t);
+
+    for (size_t i = 0; i < NumSlots; i++)
+    {
+        const uintptr_t Value = Slots[i];
+
+        if ((Value - MinValue) > ValueSpan) [[likely]]
+            continue;
+
+        if (std::binary_search(SortedValues.begin(), SortedValues.end(), Value))
+            OutHits.push_back({ reinterpret_cast<uintptr_t>(&Slots[i]), Value });
+    }
+}
+
+/*
+* Single-pass version of FindAlignedValueInProcess for several pointers at once, returns all hits sorted by address.
+*
+* Sweeps all __DATA segments of the main image once. Only if none of the pointers was found there the whole image is searched.
+*/
+inline std::vector<AlignedPointerHit> FindAlignedPointersInProcess(std::vector<uintptr_t> Values)
+{
+    std::vector<AlignedPointerHit> Hits;
+
+    std::sort(Values.begin(), Values.end());
+    Values.erase(std::unique(Values.begin(), Values.end()), Values.end());
+
+    const auto [ImageBase, ImageSize, Header] = GetImageBaseAndSize();
+
+    for (const auto& [SegmentStart, SegmentSize] : GetSegmentsByPrefix(Header, "__DATA"))
+        FindAlignedPointersInRange(Values, SegmentStart, SegmentSize, Hits);
+
+    if (Hits.empty())
+        FindAlignedPointersInRange(Values, ImageBase, ImageSize, Hits);
+
+    std::sort(Hits.begin(), Hits.end(), [](const AlignedPointerHit& Left, const AlignedPointerHit& Right) { return Left.Address < Right.Address; });
+
+    return Hits;
+}
+
 enum class InstType {
     ADRL,       // ADRP + ADD
     ADRP_LDR,   // ADRP + LDR
@@ -659,6 +707,25 @@ public:
         return FindPatternInRange(Pattern, Get<uint8_t>(), Range, Relative != 0, Relative);
     }
 
+    /* RelativePattern for several patterns at once, scans the range a single time */
+    template<size_t NumPatterns>
+    inline std::vector<MemAddress> RelativePatterns(const std::array<const char*, NumPatterns>& Patterns, int32_t Range, int32_t Relative = 0) const
+    {
+        if (!Address) return std::vector<MemAddress>(NumPatterns, nullptr);
+
+        std::vector<MemAddress> Results;
+        Results.reserve(NumPatterns);
+
+        for (void* Found : FindPatternsInRange(std::vector<const char*>(Patterns.begin(), Patterns.end()), Get<uint8_t>(), Range))
+        {
+            uintptr_t FoundAddress = reinterpret_cast<uintptr_t>(Found);
+            if (Found && Relative != 0) FoundAddress = FoundAddress + static_cast<uint32_t>(Relative);
+            Results.push_back(FoundAddress);
+        }
+
+        return Results;
+    }
+
     inline MemAddress GetRelativeCalledFunction(int32_t OneBasedFuncIndex, bool(*IsWantedTarget)(MemAddress CalledAddr) = nullptr) const
     {
         if (!Address || OneBasedFuncIndex == 0) return nullptr;
@@ -719,16 +786,8 @@ inline MemAddress FindByString(Type RefStr)
     if (FoundPtr) StringAddress = (uintptr_t)FoundPtr;
     if (!StringAddress) return nullptr;
 
-    for (int i = 0; i < TextSize; i += 4)
-    {
-        if (ASMUtils::IsADRL(TextSection + i))
-        {
-            const uintptr_t StrPtr = ASMUtils::ResolveADRL(TextSection + i);
-            if (StrPtr == StringAddress)
-                return { TextSection + i };
-        }
-    }
-    return nullptr;
+    const uintptr_t Site = XRefIndex::FindFirstXRefTo(StringAddress, EXRefKind::ADRL, TextSection, TextSection + TextSize);
+    return Site ? MemAddress(Site) : nullptr;
 }
 
 inline MemAddress FindByWString(const wchar_t* RefStr)
@@ -756,23 +815,43 @@ inline MemAddress FindByStringInAllSections(const CharType* RefStr, uintptr_t St
 
     const int32_t RefStrLen = StrlenHelper(RefStr);
 
-    for (uintptr_t i = 0; i < SearchRange; i += 4)
+    const uintptr_t SearchBegin = reinterpret_cast<uintptr_t>(SearchStart);
+    const uintptr_t SearchEnd = SearchBegin + static_cast<uint32_t>(SearchRange);
+
+    /* The index only contains ADRP+ADD (ADRL) sequences whose target lies within the image, so every target is safe to compare */
+    const uintptr_t Site = XRefIndex::FindFirstXRefTo([RefStr, RefStrLen](uintptr_t StrPtr) -> bool
     {
-        /* Check for ADRP+ADD (ADRL) sequence which loads a pointer relative to PC */
-        if (ASMUtils::IsADRL(reinterpret_cast<uintptr_t>(SearchStart) + i))
+        return StrnCmpHelper(RefStr, reinterpret_cast<const CharType*>(StrPtr), RefStrLen);
+    }, EXRefKind::ADRL, SearchBegin, SearchEnd);
+
+    /* The index covers __TEXT, only the parts of the search range outside of it are still decoded here */
+    auto FindADRLInRange = [RefStr, RefStrLen](uintptr_t Begin, uintptr_t End) -> uintptr_t
+    {
+        for (uintptr_t Address = Begin; Address + 0x8 <= End; Address += 0x4)
         {
-            const uintptr_t StrPtr = ASMUtils::ResolveADRL(reinterpret_cast<uintptr_t>(SearchStart) + i);
-            
-            if (!IsInProcessRange(StrPtr))
+            /* Check for ADRP+ADD (ADRL) sequence which loads a pointer relative to PC */
+            if (!ASMUtils::IsADRL(Address))
                 continue;
 
+            const uintptr_t StrPtr = ASMUtils::ResolveADRL(Address);
+
             /* Check if the string at the resolved address matches our target */
-            if (StrnCmpHelper(RefStr, reinterpret_cast<const CharType*>(StrPtr), RefStrLen))
-                return { reinterpret_cast<uintptr_t>(SearchStart) + i };
+            if (IsInProcessRange(StrPtr) && StrnCmpHelper(RefStr, reinterpret_cast<const CharType*>(StrPtr), RefStrLen))
+                return Address;
         }
-    }
 
-    return nullptr;
+        return 0x0;
+    };
+
+    /* Keep the lowest match, sites in front of __TEXT come before the ones found by the index */
+    if (const uintptr_t SiteBeforeText = FindADRLInRange(SearchBegin, std::min(SearchEnd, XRefIndex::GetTextStart())))
+        return { SiteBeforeText };
+
+    if (Site)
+        return { Site };
+
+    const uintptr_t SiteAfterText = FindADRLInRange(std::max(SearchBegin, XRefIndex::GetTextEnd()), SearchEnd);
+    return SiteAfterText ? MemAddress(SiteAfterText) : nullptr;
 }
 
 template<typename Type = const char*>
@@ -30,7 +30,8 @@ void StartDump()
     Generator::InitEngineCore();
     Generator::InitInternal();
 
-    if (Settings::Generator::GameName.empty() && Settings::Generator::GameVersion.empty())
+    /* The name and version are retrieved through ProcessEvent, which can't be called on a process snapshot */
+    if (Settings::Generator::GameName.empty() && Settings::Generator::GameVersion.empty() && Memory::IsLive())
     {
         FString Name;
         FString Version;